@@ -0,0 +1,137 @@
+# Benchmarks the hot paths of the Julia front-end: column indexing of scalar, fixed shape and ragged
+# columns, element boxing between Julia and casacore arrays, and measure conversions. These mirror
+# the native benchmarks of casacorecxx/benchmark, which isolate the cost of casacore itself.
+#
+# Usage: julia --project benchmark/runbenchmarks.jl [nrows...] > results.jsonl
+#
+# Results are written as JSON lines, one object per benchmark, with the same fields as the native
+# benchmarks: suite, benchmark, nrows, shape (of each cell), seconds and throughput (in unit).
+
+using Casacore.LibCasacore: LibCasacore
+using Casacore.Measures: Measures, mconvert!
+using Casacore.Tables: Tables, Table
+using Unitful: @u_str
+
+const FIXED_SHAPES = ((4,), (4, 64))
+const RAGGED_MAX = 32
+const THREADS = (2, 4, 8, 16)
+
+# Returns the fastest of several runs of f, in seconds
+function besttime(f; repeats=3)
+    f()  # compile
+    return minimum(_ -> @elapsed(f()), 1:repeats)
+end
+
+function report(benchmark, nrows, shape, seconds, count, unit)
+    println(
+        "{\"suite\":\"Casacore.jl\",\"benchmark\":\"$(benchmark)\",\"nrows\":$(nrows),",
+        "\"shape\":[$(join(shape, ','))],\"seconds\":$(seconds),\"throughput\":$(count / seconds),",
+        "\"unit\":\"$(unit)\"}"
+    )
+end
+
+function scratchtable(nrows)
+    table = Table(joinpath(mktempdir(), "benchmark.ms"), Tables.New)
+    resize!(table, nrows)
+    return table
+end
+
+function benchscalar(nrows)
+    table = scratchtable(nrows)
+    table[:SCALAR] = Tables.ScalarColumnDesc{Float64}()
+    col = table[:SCALAR]
+    values = rand(nrows)
+
+    report("scalar_setindex", nrows, (), besttime(() -> col[:] = values), nrows, "rows/s")
+    report("scalar_getindex", nrows, (), besttime(() -> col[:]), nrows, "rows/s")
+    report("scalar_getindex_row", nrows, (), besttime(() -> foreach(i -> col[i], 1:nrows)), nrows, "rows/s")
+
+    rows = rand(1:nrows, nrows)
+    report("scalar_getindex_rows", nrows, (), besttime(() -> col[rows]), nrows, "rows/s")
+end
+
+function benchfixed(nrows, shape)
+    table = scratchtable(nrows)
+    table[:FIXED] = Tables.ArrayColumnDesc{ComplexF32, length(shape)}(shape)
+    col = table[:FIXED]
+    values = rand(ComplexF32, shape..., nrows)
+    mbytes = sizeof(values) / 2^20
+    cells = ntuple(_ -> :, length(shape))
+
+    report("fixed_setindex", nrows, shape, besttime(() -> col[cells..., :] = values), mbytes, "MB/s")
+    report("fixed_getindex", nrows, shape, besttime(() -> col[cells..., :]), mbytes, "MB/s")
+    report("fixed_copyto", nrows, shape, besttime(() -> copyto!(values, col)), mbytes, "MB/s")
+    report("fixed_getindex_row", nrows, shape, besttime(() -> foreach(i -> col[cells..., i], 1:nrows)), nrows, "rows/s")
+end
+
+function benchragged(nrows)
+    table = scratchtable(nrows)
+    table[:RAGGED] = Tables.ArrayColumnDesc{Float32, 1}()
+    col = table[:RAGGED]
+    values = [rand(Float32, mod1(i, RAGGED_MAX)) for i in 1:nrows]
+
+    report("ragged_setindex", nrows, (RAGGED_MAX,), besttime(() -> col[:] = values), nrows, "rows/s")
+    report("ragged_getindex", nrows, (RAGGED_MAX,), besttime(() -> col[:]), nrows, "rows/s")
+    report("ragged_getindex_row", nrows, (RAGGED_MAX,), besttime(() -> foreach(i -> col[i], 1:nrows)), nrows, "rows/s")
+end
+
+# Element by element boxing, as used by LibCasacore.copy!() to fill casacore arrays
+function benchcopy(n)
+    arr = LibCasacore.Array{Float64}(LibCasacore.IPosition((n,)))
+    values = append!(Any[], rand(n))
+
+    report("copy_box", n, (), besttime(() -> LibCasacore.copy!(arr, values)), n, "elements/s")
+    report("copy_unbox", n, (), besttime(() -> LibCasacore.copy!(Any[], arr)), n, "elements/s")
+end
+
+function benchmeasures(n)
+    c = Measures.Converter(Measures.Directions.J2000, Measures.Directions.GALACTIC)
+
+    dir = zero(Measures.Direction)
+    report("direction_convert", n, (2,), besttime() do
+        for _ in 1:n
+            dir.type = Measures.Directions.J2000
+            mconvert!(dir, dir, c)
+        end
+    end, n, "conversions/s")
+
+    in = rand(3, n)
+    in ./= sqrt.(sum(abs2, in; dims=1))
+    out = similar(in)
+    report("direction_convert_batched", n, (2,), besttime(() -> mconvert!(out, in, c)), n, "conversions/s")
+
+    # Scaling of batched conversions across the native worker pool
+    for threads in THREADS
+        report(
+            "direction_convert_batched_threads$(threads)", n, (2,),
+            besttime(() -> mconvert!(out, in, c; threads)), n, "conversions/s"
+        )
+    end
+
+    # A frame dependent conversion, which is far more costly per value than J2000 to GALACTIC
+    pos = Measures.Position(Measures.Positions.ITRF, -2.5594e6u"m", 5.0953e6u"m", -2.8489e6u"m")
+    t = Measures.Epoch(Measures.Epochs.UTC, 59857u"d")
+    dir = Measures.Direction(Measures.Directions.J2000, 1u"rad", -0.5u"rad")
+    c = Measures.Converter(Measures.Frequencies.LSRK, Measures.Frequencies.TOPO, t, pos, dir)
+
+    in = collect(reshape(range(100e6, 200e6; length=n), 1, n))
+    out = similar(in)
+    report("frequency_convert_batched", n, (1,), besttime(() -> mconvert!(out, in, c)), n, "conversions/s")
+    for threads in THREADS
+        report(
+            "frequency_convert_batched_threads$(threads)", n, (1,),
+            besttime(() -> mconvert!(out, in, c; threads)), n, "conversions/s"
+        )
+    end
+end
+
+sizes = isempty(ARGS) ? [1_000, 10_000, 100_000] : parse.(Int, ARGS)
+for nrows in sizes
+    benchscalar(nrows)
+    for shape in FIXED_SHAPES
+        benchfixed(nrows, shape)
+    end
+    benchragged(nrows)
+    benchcopy(nrows)
+    benchmeasures(nrows)
+end
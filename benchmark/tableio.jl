@@ -0,0 +1,47 @@
+# Compares DATA column throughput of the tiled storage manager I/O modes.
+#
+# Usage: julia --project benchmark/tableio.jl [nrows]
+#
+# Note that reads are likely to be served from the OS page cache, since each table has just been
+# written. Drop the page cache between the write and read passes for cold read figures.
+
+using Casacore.Tables: Tables, Table
+
+function benchmark(mode::Symbol, nrows::Int; shape=(4, 64), tileshape=(4, 64, 128))
+    path = joinpath(mktempdir(), "$(mode).ms")
+    vals = rand(ComplexF32, shape..., nrows)
+    nbytes = sizeof(vals)
+
+    table = Table(path, Tables.New; io=mode)
+    resize!(table, nrows)
+    table[:DATA] = Tables.ArrayColumnDesc{ComplexF32, length(shape)}(
+        shape; datamanager=Tables.TiledColumnStMan(tileshape)
+    )
+    writetime = @elapsed begin
+        table[:DATA][:, :, :] = vals
+        Tables.flush(table)
+    end
+    table = nothing
+    GC.gc(true)
+
+    table = Table(path, Tables.Old; io=mode)
+    readtime = @elapsed table[:DATA][:, :, :]
+
+    # Read a single channel across all rows, which touches every tile
+    channeltime = @elapsed table[:DATA][:, 1, :]
+
+    return (
+        write = nbytes / writetime / 2^20,
+        read = nbytes / readtime / 2^20,
+        channel = nrows / channeltime,
+    )
+end
+
+nrows = isempty(ARGS) ? 100_000 : parse(Int, ARGS[1])
+
+benchmark(:cache, 1_000)  # warm up
+println("mode\twrite (MB/s)\tread (MB/s)\tchannel read (rows/s)")
+for mode in (:cache, :buffer, :mmap)
+    result = benchmark(mode, nrows)
+    println(join((mode, round(result.write; digits=1), round(result.read; digits=1), round(Int, result.channel)), '\t'))
+end
@@ -0,0 +1,169 @@
+// Native microbenchmarks of the casacore calls on the hot paths wrapped by casacorecxx, run against
+// scratch tables generated for each table size. Results are written to stdout as JSON lines, one
+// object per benchmark, for comparison between versions.
+//
+// Usage: casacorecxx_benchmark [nrows...]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <casacore/casa/Arrays.h>
+#include <casacore/measures/Measures.h>
+#include <casacore/measures/Measures/MCDirection.h>
+#include <casacore/measures/Measures/MDirection.h>
+#include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan.h>
+
+using namespace casacore;
+
+// Shape of the fixed shape (e.g. DATA) column cells, and of its tiles
+const IPosition FIXED_SHAPE(2, 4, 64);
+const IPosition FIXED_TILESHAPE(3, 4, 64, 128);
+
+// Ragged cells have between 1 and RAGGED_MAX elements
+const size_t RAGGED_MAX = 32;
+
+// Returns the fastest of several runs of f, in seconds
+double besttime(const std::function<void()> & f, int repeats = 3) {
+    double best = std::numeric_limits<double>::max();
+    for (int i = 0; i < repeats; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, elapsed.count());
+    }
+    return best;
+}
+
+void report(const std::string & name, rownr_t nrows, const IPosition & shape, double seconds, double count, const std::string & unit) {
+    std::cout << "{\"suite\":\"casacorecxx\",\"benchmark\":\"" << name << "\",\"nrows\":" << nrows << ",\"shape\":[";
+    for (size_t i = 0; i < shape.size(); ++i) {
+        std::cout << (i > 0 ? "," : "") << shape[i];
+    }
+    std::cout << "],\"seconds\":" << seconds << ",\"throughput\":" << count / seconds
+              << ",\"unit\":\"" << unit << "\"}" << std::endl;
+}
+
+Table scratchtable(rownr_t nrows) {
+    TableDesc desc;
+    desc.addColumn(ScalarColumnDesc<Double>("SCALAR"));
+    desc.addColumn(ArrayColumnDesc<Complex>("FIXED", FIXED_SHAPE, ColumnDesc::FixedShape));
+    desc.addColumn(ArrayColumnDesc<Float>("RAGGED"));
+
+    const std::string path = (
+        std::filesystem::temp_directory_path() / ("casacorecxx_benchmark_" + std::to_string(nrows) + ".tab")
+    ).string();
+    SetupNewTable setup(path, desc, Table::Scratch);
+    StandardStMan standard;
+    setup.bindAll(standard);
+    TiledColumnStMan tiled("TiledFixed", FIXED_TILESHAPE);
+    setup.bindColumn("FIXED", tiled);
+
+    return Table(setup, nrows);
+}
+
+void benchscalar(Table & table) {
+    const rownr_t nrows = table.nrow();
+    const IPosition shape(0);
+    ScalarColumn<Double> col(table, "SCALAR");
+    const Slicer rows(IPosition(1, 0), IPosition(1, nrows));
+    Vector<Double> values(nrows, 1.0);
+
+    double seconds = besttime([&]() { col.putColumnRange(rows, values); });
+    report("scalar_put_range", nrows, shape, seconds, nrows, "rows/s");
+
+    seconds = besttime([&]() { col.getColumnRange(rows, values, False); });
+    report("scalar_get_range", nrows, shape, seconds, nrows, "rows/s");
+
+    // One call per row, as when indexing single rows
+    Vector<Double> value(1);
+    seconds = besttime([&]() {
+        for (rownr_t i = 0; i < nrows; ++i) {
+            col.getColumnRange(Slicer(IPosition(1, i), IPosition(1, 1)), value, False);
+        }
+    });
+    report("scalar_get_row", nrows, shape, seconds, nrows, "rows/s");
+}
+
+void benchfixed(Table & table) {
+    const rownr_t nrows = table.nrow();
+    ArrayColumn<Complex> col(table, "FIXED");
+    const Slicer rows(IPosition(1, 0), IPosition(1, nrows));
+    Array<Complex> values(FIXED_SHAPE.concatenate(IPosition(1, nrows)), Complex(1, 1));
+    const double mbytes = values.nelements() * sizeof(Complex) / double(1 << 20);
+
+    double seconds = besttime([&]() { col.putColumnRange(rows, values); });
+    report("fixed_put_range", nrows, FIXED_SHAPE, seconds, mbytes, "MB/s");
+
+    seconds = besttime([&]() { col.getColumnRange(rows, values, False); });
+    report("fixed_get_range", nrows, FIXED_SHAPE, seconds, mbytes, "MB/s");
+
+    // A single channel of all rows, which touches every tile
+    const Slicer channel(IPosition(2, 0, 0), IPosition(2, FIXED_SHAPE[0], 1));
+    Array<Complex> channelvalues(IPosition(3, FIXED_SHAPE[0], 1, nrows));
+    seconds = besttime([&]() { col.getColumnRange(rows, channel, channelvalues, False); });
+    report("fixed_get_channel", nrows, FIXED_SHAPE, seconds, nrows, "rows/s");
+
+    Array<Complex> cell(FIXED_SHAPE);
+    seconds = besttime([&]() {
+        for (rownr_t i = 0; i < nrows; ++i) col.get(i, cell, False);
+    });
+    report("fixed_get_row", nrows, FIXED_SHAPE, seconds, nrows, "rows/s");
+}
+
+void benchragged(Table & table) {
+    const rownr_t nrows = table.nrow();
+    const IPosition shape(1, RAGGED_MAX);
+    ArrayColumn<Float> col(table, "RAGGED");
+    std::vector<Vector<Float>> cells;
+    for (size_t n = 1; n <= RAGGED_MAX; ++n) cells.emplace_back(n, Float(n));
+
+    double seconds = besttime([&]() {
+        for (rownr_t i = 0; i < nrows; ++i) col.put(i, cells[i % RAGGED_MAX]);
+    });
+    report("ragged_put_row", nrows, shape, seconds, nrows, "rows/s");
+
+    Array<Float> cell;
+    seconds = besttime([&]() {
+        for (rownr_t i = 0; i < nrows; ++i) col.get(i, cell, True);
+    });
+    report("ragged_get_row", nrows, shape, seconds, nrows, "rows/s");
+}
+
+void benchmeasures(size_t n) {
+    const IPosition shape(1, 2);
+    MDirection::Convert c(MDirection::J2000, MDirection::Ref(MDirection::GALACTIC));
+    MDirection in(MVDirection(Quantity(1, "rad"), Quantity(0.5, "rad")), MDirection::J2000);
+    MDirection out;
+
+    // As for the (scalar) convert! wrapper, converting and copying into an existing measure
+    double seconds = besttime([&]() {
+        for (size_t i = 0; i < n; ++i) {
+            const MDirection & tmp = c(in.getValue());
+            out.set(tmp.getValue(), tmp.getRef());
+        }
+    });
+    report("direction_convert", n, shape, seconds, n, "conversions/s");
+}
+
+int main(int argc, char * argv[]) {
+    std::vector<rownr_t> sizes;
+    for (int i = 1; i < argc; ++i) sizes.push_back(std::strtoull(argv[i], nullptr, 10));
+    if (sizes.empty()) sizes = {1'000, 10'000, 100'000};
+
+    for (rownr_t nrows : sizes) {
+        Table table = scratchtable(nrows);
+        benchscalar(table);
+        benchfixed(table);
+        benchragged(table);
+        benchmeasures(nrows);
+    }
+    return 0;
+}
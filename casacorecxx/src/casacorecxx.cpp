@@ -1,3 +1,28 @@
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
 #include <jlcxx/jlcxx.hpp>
 #include <jlcxx/stl.hpp>
 
@@ -26,6 +51,7 @@
 #include <casacore/measures/Measures/MRadialVelocity.h>
 #include <casacore/measures/Measures/Muvw.h>
 #include <casacore/tables/Tables.h>
+#include <casacore/tables/DataMan.h>
 #include <casacore/tables/TaQL.h>
 
 using namespace casacore;
@@ -38,6 +64,11 @@ public:
         return _measuresDir;
     }
 
+    // Tables that casacore has already opened are not reopened from the new directory
+    void setMeasuresDir(std::string measuresDir) {
+        _measuresDir = measuresDir;
+    }
+
     bool initialized() const override {
         return true;
     }
@@ -46,6 +77,800 @@ private:
     std::string _measuresDir;
 };
 
+// Native conversions hold a shared lock for their duration, whilst (re)initialisation of the
+// AppState (and hence the location of the measures tables) requires exclusive access.
+std::shared_mutex measuresmutex;
+
+// A persistent pool of native worker threads, shared by all parallel conversions so that threads
+// are not started and joined on every call. Workers are started lazily, as larger batches are
+// requested, and live until the library is unloaded. The calling thread always participates in its
+// own batch, and so a batch still completes (serially) if every worker is busy, e.g. when batches
+// are submitted concurrently from several Julia threads.
+class WorkerPool {
+public:
+    static WorkerPool & instance() {
+        static WorkerPool pool;
+        return pool;
+    }
+
+    // Run task(i) for every i in [0, ntasks), returning once all tasks have completed. At most
+    // ntasks tasks run concurrently. Tasks must not throw.
+    void run(size_t ntasks, const std::function<void(size_t)> & task) {
+        auto batch = std::make_shared<Batch>(task, ntasks);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (threads.size() < ntasks - 1) {
+                threads.emplace_back([this]() { work(); });
+            }
+            batches.push_back(batch);
+        }
+        available.notify_all();
+
+        while (batch->runnext()) {}
+
+        {
+            std::unique_lock<std::mutex> lock(batch->mutex);
+            batch->completed.wait(lock, [&]() { return batch->ndone == batch->ntasks; });
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        batches.erase(std::remove(batches.begin(), batches.end(), batch), batches.end());
+    }
+
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        available.notify_all();
+        for (auto & thread : threads) thread.join();
+    }
+
+private:
+    struct Batch {
+        Batch(const std::function<void(size_t)> & task, size_t ntasks) : task(task), ntasks(ntasks) {}
+
+        // Claim and run the next task of this batch, returning false once all tasks are claimed
+        bool runnext() {
+            const size_t i = next++;
+            if (i >= ntasks) return false;
+            task(i);
+
+            std::lock_guard<std::mutex> lock(mutex);
+            if (++ndone == ntasks) completed.notify_all();
+            return true;
+        }
+
+        const std::function<void(size_t)> & task;
+        const size_t ntasks;
+        std::atomic<size_t> next{0};
+        size_t ndone = 0;
+        std::mutex mutex;
+        std::condition_variable completed;
+    };
+
+    WorkerPool() = default;
+
+    void work() {
+        while (true) {
+            std::shared_ptr<Batch> batch;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                available.wait(lock, [&]() { return stopping || !batches.empty(); });
+                if (stopping) return;
+                batch = batches.front();
+            }
+
+            if (!batch->runnext()) {
+                // Every task of this batch has been claimed: retire it from the queue
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!batches.empty() && batches.front() == batch) batches.pop_front();
+            }
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable available;
+    std::deque<std::shared_ptr<Batch>> batches;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+};
+
+// Run fn(start, end) over [0, n), partitioned into contiguous chunks across up to nthreads threads
+// of the WorkerPool (including the calling thread). The first item is always processed on the
+// calling thread before any chunks are submitted, so that lazily initialised shared state (e.g.
+// MeasTable and the IERS and JPL tables) is set up serially. Any exceptions are rethrown on the
+// calling thread.
+template<typename F>
+void parallelfor(size_t n, size_t nthreads, F fn) {
+    if (n == 0) return;
+    fn(0, 1);
+
+    const size_t nworkers = std::max<size_t>(1, std::min<size_t>(nthreads, n - 1));
+    if (nworkers == 1) {
+        if (n > 1) fn(1, n);
+        return;
+    }
+
+    std::vector<std::exception_ptr> errors(nworkers);
+    WorkerPool::instance().run(nworkers, [&](size_t i) {
+        const size_t start = 1 + (i * (n - 1)) / nworkers;
+        const size_t end = 1 + ((i + 1) * (n - 1)) / nworkers;
+        try {
+            fn(start, end);
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    for (auto & error : errors) {
+        if (error) std::rethrow_exception(error);
+    }
+}
+
+// Deep copy a frame. Frames cache frame dependent values (e.g. sidereal time) as they are used,
+// and so each thread requires its own copy.
+MeasFrame copyframe(const MeasFrame & frame) {
+    MeasFrame copy;
+    if (frame.epoch()) copy.set(*frame.epoch());
+    if (frame.position()) copy.set(*frame.position());
+    if (frame.direction()) copy.set(*frame.direction());
+    if (frame.radialVelocity()) copy.set(*frame.radialVelocity());
+    return copy;
+}
+
+// Whether table is a daily IERS table, holding one row per consecutive day from MJD0 + 1
+bool isdailyiers(const Table & table) {
+    if (
+        table.tableInfo().type() != "IERS" || !table.tableDesc().isColumn("MJD") ||
+        !table.keywordSet().isDefined("MJD0") || table.nrow() < 2
+    ) return false;
+
+    const Vector<Double> mjds = ScalarColumn<Double>(table, "MJD").getColumn();
+    if (mjds[0] != table.keywordSet().asDouble("MJD0") + 1) return false;
+    for (size_t i = 1; i < mjds.size(); ++i) {
+        if (mjds[i] != mjds[i - 1] + 1) return false;
+    }
+    return true;
+}
+
+// Copy the measures tables (of the geodetic and ephemerides directories) in srcdir to destdir,
+// restricting the daily IERS tables to the days spanning [mjdstart, mjdend] and updating their
+// MJD0 to match. All other tables are copied in full.
+void snapshotmeasures(const std::string & srcdir, const std::string & destdir, double mjdstart, double mjdend) {
+    namespace fs = std::filesystem;
+    for (const std::string subdir : {"geodetic", "ephemerides"}) {
+        const fs::path src = fs::path(srcdir) / subdir;
+        const fs::path dest = fs::path(destdir) / subdir;
+        if (!fs::is_directory(src)) continue;
+        fs::create_directories(dest);
+
+        for (const auto & entry : fs::directory_iterator(src)) {
+            const String path = entry.path().string();
+            const String destpath = (dest / entry.path().filename()).string();
+            if (!Table::isReadable(path)) continue;
+
+            const Table table(path);
+            if (isdailyiers(table)) {
+                const Table selection = table(
+                    table.col("MJD") >= std::floor(mjdstart) - 1 && table.col("MJD") <= std::ceil(mjdend) + 1
+                );
+                if (selection.nrow() > 0) {
+                    selection.deepCopy(destpath, Table::New, True);
+
+                    Table copy(destpath, Table::Update);
+                    const Double mjd0 = ScalarColumn<Double>(copy, "MJD")(0) - 1;
+                    TableRecord & keywords = copy.rwKeywordSet();
+                    if (keywords.dataType("MJD0") == TpInt) {
+                        keywords.define("MJD0", Int(mjd0));
+                    } else {
+                        keywords.define("MJD0", mjd0);
+                    }
+                    continue;
+                }
+            }
+            table.deepCopy(destpath, Table::New, True);
+        }
+    }
+}
+
+// Read the measures tables used in conversions of epochs in [mjdstart, mjdend], returning the time
+// taken in seconds. The IERS and leap second tables are read into memory in full on first use,
+// whilst the rows of the JPL ephemerides are read as each day of the range is visited.
+double preloadmeasures(double mjdstart, double mjdend) {
+    std::unique_lock<std::shared_mutex> lock(measuresmutex);
+    const auto start = std::chrono::steady_clock::now();
+    for (double mjd = mjdstart; mjd < mjdend + 1; mjd += 1) {
+        MeasTable::dUTC(mjd);
+        MeasTable::dUT1(mjd);
+        MeasTable::polarMotion(mjd);
+        MeasTable::Planetary(MeasTable::EARTH, mjd);
+    }
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Pack and unpack measure values to and from contiguous buffers of doubles, using the same layout
+// as putVector(). MVEpoch splits its value into whole and fractional days, so it is special cased
+// to pack as a single value.
+template<typename TV>
+void packvalue(const TV & mv, double * ptr, size_t length) {
+    const Vector<double> vec = mv.getVector();
+    std::copy_n(vec.data(), std::min<size_t>(length, vec.nelements()), ptr);
+}
+
+inline void packvalue(const MVEpoch & mv, double * ptr, size_t) {
+    ptr[0] = mv.get();
+}
+
+template<typename TV>
+void unpackvalue(TV & mv, double * ptr, ssize_t length) {
+    Vector<double> vec{IPosition{length}, ptr, SHARE};
+    mv.putVector(vec);
+}
+
+// Bulk string transfer: the strings of an array are packed (in storage order) into a single
+// contiguous byte buffer, with offsets[i] and offsets[i + 1] delimiting the ith string. This avoids
+// boxing each element as its own Julia object when crossing the language boundary.
+size_t nbytes(const Array<String> & arr) {
+    size_t n = 0;
+    for (const auto & str : arr) n += str.size();
+    return n;
+}
+
+void packstrings(const Array<String> & arr, unsigned char * bytes, int64_t * offsets) {
+    int64_t offset = 0;
+    offsets[0] = 0;
+    size_t i = 0;
+    for (const auto & str : arr) {
+        std::memcpy(bytes + offset, str.data(), str.size());
+        offset += str.size();
+        offsets[++i] = offset;
+    }
+}
+
+void unpackstrings(Array<String> & arr, const unsigned char * bytes, const int64_t * offsets) {
+    size_t i = 0;
+    for (auto & str : arr) {
+        str.assign(reinterpret_cast<const char *>(bytes) + offsets[i], offsets[i + 1] - offsets[i]);
+        ++i;
+    }
+}
+
+// Optional instrumentation of column I/O (per table and column) and of measure conversions (per
+// measure type), recording the number of calls, the bytes or values transferred and the wall time.
+// Whilst disabled (the default), an instrumented call costs only a relaxed atomic load.
+struct IOStats {
+    // Indexed by get (0) and put (1)
+    uint64_t calls[2] = {0, 0};
+    uint64_t bytes[2] = {0, 0};
+    double seconds[2] = {0, 0};
+};
+
+struct ConversionStats {
+    uint64_t calls = 0;
+    uint64_t conversions = 0;
+    double seconds = 0;
+};
+
+std::atomic<bool> iostatsenabled{false};
+std::atomic<bool> conversionstatsenabled{false};
+std::mutex statsmutex;
+std::map<std::pair<std::string, std::string>, IOStats> iostats;
+std::map<std::string, ConversionStats> conversionstats;
+
+class Stopwatch {
+public:
+    explicit Stopwatch(const std::atomic<bool> & enabled) : enabled(enabled.load(std::memory_order_relaxed)) {
+        if (this->enabled) start = std::chrono::steady_clock::now();
+    }
+
+    explicit operator bool() const { return enabled; }
+
+    double seconds() const {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+private:
+    bool enabled;
+    std::chrono::steady_clock::time_point start;
+};
+
+void recordio(const TableColumn & col, bool put, size_t bytes, double seconds) {
+    const std::pair<std::string, std::string> key(col.table().tableName(), col.columnDesc().name());
+    std::lock_guard<std::mutex> lock(statsmutex);
+    IOStats & stats = iostats[key];
+    stats.calls[put] += 1;
+    stats.bytes[put] += bytes;
+    stats.seconds[put] += seconds;
+}
+
+void recordconversion(const std::string & mname, size_t n, double seconds) {
+    std::lock_guard<std::mutex> lock(statsmutex);
+    ConversionStats & stats = conversionstats[mname];
+    stats.calls += 1;
+    stats.conversions += n;
+    stats.seconds += seconds;
+}
+
+// Bytes of column data (of type T) held by x, which is either an array of cells or a single value
+template<typename T, typename X>
+size_t databytes(const X & x) {
+    if constexpr (std::is_base_of<ArrayBase, X>::value) {
+        if constexpr (std::is_same<T, String>::value) return nbytes(x);
+        else return x.nelements() * sizeof(T);
+    } else if constexpr (std::is_same<X, T>::value) {
+        if constexpr (std::is_same<T, String>::value) return x.size();
+        else return sizeof(T);
+    } else {
+        return 0;
+    }
+}
+
+// Wrap a column's get (const) or put (non-const) method as a lambda that records the call whilst
+// I/O instrumentation is enabled. Data is counted from arguments passed by reference (ignoring row
+// numbers and flags, which are passed by value), or otherwise from the result.
+template<typename T, typename Arg, typename X>
+size_t argbytes(const X & x) {
+    return std::is_reference<Arg>::value ? databytes<T>(x) : 0;
+}
+
+template<typename T, typename C, typename R, typename... Args>
+auto instrumented(R (C::*method)(Args...) const) {
+    return [method](const C & col, Args... args) -> R {
+        const Stopwatch stopwatch(iostatsenabled);
+        if constexpr (std::is_void<R>::value) {
+            (col.*method)(args...);
+            if (stopwatch) recordio(col, false, (argbytes<T, Args>(args) + ... + size_t(0)), stopwatch.seconds());
+        } else {
+            R result = (col.*method)(args...);
+            if (stopwatch) recordio(col, false, databytes<T>(result), stopwatch.seconds());
+            return result;
+        }
+    };
+}
+
+template<typename T, typename C, typename... Args>
+auto instrumented(void (C::*method)(Args...)) {
+    return [method](C & col, Args... args) {
+        const Stopwatch stopwatch(iostatsenabled);
+        (col.*method)(args...);
+        if (stopwatch) recordio(col, true, (argbytes<T, Args>(args) + ... + size_t(0)), stopwatch.seconds());
+    };
+}
+
+// Reads consecutive chunks of rows from a set of columns on a background thread, alternating
+// between two sets of caller owned buffers. This allows the next chunk to be read whilst the
+// caller processes the current one. Readers are added per column by the typed addreader!()
+// methods of ScalarColumn and ArrayColumn.
+class ChunkReader {
+public:
+    typedef std::function<void(rownr_t start, rownr_t n, size_t buffer)> Reader;
+
+    // Any error of a read that was never waited on cannot be rethrown here, and is discarded
+    ~ChunkReader() {
+        if (pending.valid()) pending.wait();
+    }
+
+    void add(Reader reader) {
+        readers.push_back(std::move(reader));
+    }
+
+    // Start reading rows [start, start + n) into buffer (0 or 1) in the background, first waiting
+    // for any read still in progress and rethrowing its exception
+    void prefetch(rownr_t start, rownr_t n, size_t buffer) {
+        if (pending.valid()) pending.get();
+        pending = std::async(std::launch::async, [this, start, n, buffer]() {
+            for (auto & reader : readers) reader(start, n, buffer);
+        });
+    }
+
+    // Wait for the current read to complete, rethrowing any exception
+    void wait() {
+        if (pending.valid()) pending.get();
+    }
+
+private:
+    std::vector<Reader> readers;
+    std::future<void> pending;
+};
+
+// Reads the columns of several tables concurrently, on up to nthreads threads. Reads are added per
+// column by the typed addreader!() methods of ScalarColumn and ArrayColumn, each reading a full
+// column into a caller owned buffer. Reads are grouped into parts by their root table, and the
+// reads of any one part are performed in turn by a single thread, since a table and its storage
+// managers must not be accessed concurrently. This holds also where the same table is given more
+// than once, or for reference tables (e.g. selections) of the same table.
+class ParallelReader {
+public:
+    typedef std::function<void()> Read;
+
+    explicit ParallelReader(size_t nthreads) : nthreads(std::max<size_t>(nthreads, 1)) {}
+
+    void add(const Table & table, Read read) {
+        const std::string root = table.baseTablePtr()->root()->tableName();
+        const auto it = partindex.emplace(root, parts.size()).first;
+        if (it->second == parts.size()) parts.emplace_back();
+        parts[it->second].push_back(std::move(read));
+    }
+
+    // Perform all reads, returning once they are complete and rethrowing the first error. Reads of
+    // parts not yet started when an error is raised are skipped.
+    void run() {
+        std::atomic<size_t> next{0};
+        std::atomic<bool> failed{false};
+        std::vector<std::future<void>> workers;
+        for (size_t i = 0; i < std::min(nthreads, parts.size()); ++i) {
+            workers.push_back(std::async(std::launch::async, [this, &next, &failed]() {
+                for (size_t part = next++; part < parts.size() && !failed; part = next++) {
+                    try {
+                        for (auto & read : parts[part]) read();
+                    } catch (...) {
+                        failed = true;
+                        throw;
+                    }
+                }
+            }));
+        }
+
+        std::exception_ptr error;
+        for (auto & worker : workers) {
+            try {
+                worker.get();
+            } catch (...) {
+                if (!error) error = std::current_exception();
+            }
+        }
+        parts.clear();
+        partindex.clear();
+        if (error) std::rethrow_exception(error);
+    }
+
+private:
+    size_t nthreads;
+    std::vector<std::vector<Read>> parts;
+    std::map<std::string, size_t> partindex;  // root table name => part
+};
+
+// Appends rows to a table and writes them from a set of caller owned buffers, one per column, in a
+// single call. Writers are added per column by the typed addwriter!() methods of ScalarColumn and
+// ArrayColumn, and each reads the n rows being appended from the start of its buffer.
+class RowAppender {
+public:
+    typedef std::function<void(rownr_t start, rownr_t n)> Writer;
+
+    explicit RowAppender(const Table & table) : table(table) {}
+
+    void add(Writer writer) {
+        writers.push_back(std::move(writer));
+    }
+
+    // Append n rows, returning the index of the first. If any write fails, the rows are removed
+    // again (where the table supports it) before the error is rethrown.
+    rownr_t append(rownr_t n) {
+        const rownr_t start = table.nrow();
+        table.addRow(n);
+        try {
+            for (auto & writer : writers) writer(start, n);
+        } catch (...) {
+            removerows(start, n);
+            throw;
+        }
+        return start;
+    }
+
+    // Remove rows [start, start + n), e.g. to roll back a failed append. Errors are ignored, since
+    // this is used whilst handling another error.
+    void removerows(rownr_t start, rownr_t n) {
+        try {
+            if (n == 0 || !table.canRemoveRow()) return;
+            Vector<rownr_t> rows(n);
+            for (rownr_t i = 0; i < n; ++i) rows[i] = start + i;
+            table.removeRow(RowNumbers(rows));
+        } catch (...) {}
+    }
+
+private:
+    Table table;
+    std::vector<Writer> writers;
+};
+
+// Performs column writes on a background thread, so that callers can continue computing whilst
+// data is written. Each write owns a copy of its data. Enqueuing blocks whilst more than maxbytes
+// of writes are pending, and the first error raised by a write is rethrown by the next call to
+// enqueue() or wait(); writes still queued at that point are discarded. Writes are enqueued per
+// column by the typed enqueueput!() methods of ScalarColumn and ArrayColumn.
+class WriteQueue {
+public:
+    typedef std::function<void()> Write;
+
+    explicit WriteQueue(size_t maxbytes) : maxbytes(maxbytes), worker([this]() { run(); }) {}
+
+    // Completes any remaining writes before returning. This is usually run by a Julia finalizer,
+    // where errors cannot be rethrown, and so an error not yet raised by wait() is reported on
+    // stderr rather than being lost silently.
+    ~WriteQueue() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        changed.notify_all();
+        worker.join();
+
+        try {
+            rethrow();
+        } catch (const std::exception & e) {
+            std::cerr << "WriteQueue: discarding error of a write that was never waited on: " << e.what() << std::endl;
+        } catch (...) {
+            std::cerr << "WriteQueue: discarding error of a write that was never waited on" << std::endl;
+        }
+    }
+
+    void enqueue(Write write, size_t nbytes) {
+        std::unique_lock<std::mutex> lock(mutex);
+        // A write larger than maxbytes is still accepted once the queue is empty
+        changed.wait(lock, [&]() { return error || pending == 0 || pending + nbytes <= maxbytes; });
+        rethrow();
+        writes.emplace_back(std::move(write), nbytes);
+        pending += nbytes;
+        changed.notify_all();
+    }
+
+    // Wait for all enqueued writes to complete, rethrowing any exception
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        changed.wait(lock, [&]() { return pending == 0; });
+        rethrow();
+    }
+
+private:
+    void rethrow() {
+        if (error) {
+            std::exception_ptr e = error;
+            error = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+
+    void run() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            changed.wait(lock, [&]() { return stopping || !writes.empty(); });
+            if (writes.empty()) return;
+
+            auto [write, nbytes] = std::move(writes.front());
+            writes.pop_front();
+
+            lock.unlock();
+            std::exception_ptr e;
+            try {
+                write();
+            } catch (...) {
+                e = std::current_exception();
+            }
+            lock.lock();
+
+            pending -= nbytes;
+            if (e) {
+                if (!error) error = e;
+                for (const auto & queued : writes) pending -= queued.second;
+                writes.clear();
+            }
+            changed.notify_all();
+        }
+    }
+
+    const size_t maxbytes;
+    size_t pending = 0;
+    bool stopping = false;
+    std::deque<std::pair<Write, size_t>> writes;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable changed;
+    std::thread worker;
+};
+
+// Statistics of complex samples are computed over their amplitudes
+template<typename T>
+double statvalue(const T & x) {
+    if constexpr (std::is_same<T, Complex>::value || std::is_same<T, DComplex>::value) {
+        return std::abs(x);
+    } else {
+        return static_cast<double>(x);
+    }
+}
+
+// Streams through a scalar or fixed shape column in chunks of rows, accumulating statistics of its
+// samples, excluding those set in the (optional) flag column of the same shape. Writes the number
+// of unflagged and flagged samples, min, max, mean and sum of squared deviations from the mean
+// into out[0:6]. The mean and squared deviations are accumulated with Welford's method, which
+// (unlike the sum of squares) remains accurate where the mean is large compared with the spread,
+// e.g. for TIME.
+template<template<typename> class ColumnT, typename T>
+void columnstatistics(const ColumnT<T> & col, const String & flagname, rownr_t chunkrows, double * out) {
+    std::unique_ptr<ColumnT<Bool>> flags;
+    if (!flagname.empty()) flags.reset(new ColumnT<Bool>(col.table(), flagname));
+
+    double n = 0, nflagged = 0, mean = 0, m2 = 0;
+    double min = std::numeric_limits<double>::infinity(), max = -min;
+
+    decltype(col.getColumnRange(std::declval<Slicer>())) values;
+    decltype(flags->getColumnRange(std::declval<Slicer>())) flagvalues;
+    const rownr_t nrow = col.nrow();
+    for (rownr_t start = 0; start < nrow; start += chunkrows) {
+        const Slicer rows(IPosition(1, start), IPosition(1, std::min(chunkrows, nrow - start)));
+        col.getColumnRange(rows, values, True);
+        if (flags) {
+            flags->getColumnRange(rows, flagvalues, True);
+            if (!flagvalues.shape().isEqual(values.shape())) {
+                throw std::invalid_argument("Flag column " + flagname + " does not match the shape of column " + col.columnDesc().name());
+            }
+        }
+
+        const T * data = values.data();
+        const Bool * flagged = flags ? flagvalues.data() : nullptr;
+        for (size_t i = 0; i < values.nelements(); ++i) {
+            if (flagged && flagged[i]) {
+                ++nflagged;
+                continue;
+            }
+            const double x = statvalue(data[i]);
+            ++n;
+            min = std::min(min, x);
+            max = std::max(max, x);
+            const double delta = x - mean;
+            mean += delta / n;
+            m2 += delta * (x - mean);
+        }
+    }
+
+    out[0] = n;
+    out[1] = nflagged;
+    out[2] = min;
+    out[3] = max;
+    out[4] = mean;
+    out[5] = m2;
+}
+
+template<typename T> struct Accumulator { typedef Double type; };
+template<> struct Accumulator<Complex> { typedef DComplex type; };
+template<> struct Accumulator<DComplex> { typedef DComplex type; };
+
+// Averages the cells of a fixed shape column in bins of cellbin samples along each cell axis and
+// of rowbin consecutive rows, streaming through the column in chunks of rows. Samples are weighted
+// by the (optional) weight column, whose cells match the leading axes of the data cells (e.g.
+// WEIGHT or WEIGHT_SPECTRUM for DATA), and excluded if set in the (optional) flag column. The
+// averages and total weights of each bin are written to out and outweight; empty bins are 0.
+template<typename T>
+void averagecolumn(
+    const ArrayColumn<T> & col, const String & flagname, const String & weightname,
+    const IPosition & cellbin, rownr_t rowbin, rownr_t chunkrows, T * out, double * outweight
+) {
+    typedef typename Accumulator<T>::type Acc;
+
+    const IPosition cellshape = col.shapeColumn();
+    if (cellbin.size() != cellshape.size()) {
+        throw std::invalid_argument("Bins must be given for each cell axis");
+    }
+    IPosition outshape(cellshape.size());
+    for (size_t axis = 0; axis < cellshape.size(); ++axis) {
+        outshape[axis] = (cellshape[axis] + cellbin[axis] - 1) / cellbin[axis];
+    }
+    const size_t ncell = cellshape.product();
+    const size_t noutcell = outshape.product();
+
+    // Map each sample of a cell to the (flat) index of its bin
+    std::vector<size_t> cellmap(ncell);
+    for (size_t k = 0; k < ncell; ++k) {
+        size_t rem = k, stride = 1;
+        for (size_t axis = 0; axis < cellshape.size(); ++axis) {
+            cellmap[k] += (rem % cellshape[axis]) / cellbin[axis] * stride;
+            rem /= cellshape[axis];
+            stride *= outshape[axis];
+        }
+    }
+
+    std::unique_ptr<ArrayColumn<Bool>> flags;
+    if (!flagname.empty()) {
+        flags.reset(new ArrayColumn<Bool>(col.table(), flagname));
+        if (!flags->shapeColumn().isEqual(cellshape)) {
+            throw std::invalid_argument("Flag column " + flagname + " does not match the cell shape of column " + col.columnDesc().name());
+        }
+    }
+
+    std::unique_ptr<ArrayColumn<Float>> weights;
+    size_t nweight = 1;
+    if (!weightname.empty()) {
+        weights.reset(new ArrayColumn<Float>(col.table(), weightname));
+        // Variable shape weights (e.g. WEIGHT of many measurement sets) must still have the same
+        // shape in every row, which is checked as each chunk is read
+        IPosition weightshape = weights->shapeColumn();
+        if (weightshape.empty() && col.nrow() > 0) weightshape = weights->shape(0);
+        if (
+            weightshape.empty() || weightshape.size() > cellshape.size() ||
+            !weightshape.isEqual(cellshape.getFirst(weightshape.size()))
+        ) {
+            throw std::invalid_argument("Weight column " + weightname + " does not match the leading cell axes of column " + col.columnDesc().name());
+        }
+        nweight = weightshape.product();
+    }
+
+    const rownr_t nrow = col.nrow();
+    const size_t nout = (nrow + rowbin - 1) / rowbin * noutcell;
+    std::vector<Acc> sums(nout);
+    std::fill_n(outweight, nout, 0.0);
+
+    // Chunks contain whole row bins
+    chunkrows = std::max(rowbin, chunkrows / rowbin * rowbin);
+
+    Array<T> values;
+    Array<Bool> flagvalues;
+    Array<Float> weightvalues;
+    for (rownr_t start = 0; start < nrow; start += chunkrows) {
+        const rownr_t n = std::min(chunkrows, nrow - start);
+        const Slicer rows(IPosition(1, start), IPosition(1, n));
+        col.getColumnRange(rows, values, True);
+        if (flags) flags->getColumnRange(rows, flagvalues, True);
+        if (weights) {
+            weights->getColumnRange(rows, weightvalues, True);
+            if (weightvalues.nelements() != nweight * n) {
+                throw std::invalid_argument("Weight column " + weightname + " does not have the same shape in every row");
+            }
+        }
+
+        const T * data = values.data();
+        const Bool * flagged = flags ? flagvalues.data() : nullptr;
+        const Float * weight = weights ? weightvalues.data() : nullptr;
+        for (rownr_t r = 0; r < n; ++r) {
+            const size_t offset = (start + r) / rowbin * noutcell;
+            for (size_t k = 0; k < ncell; ++k) {
+                const size_t i = r * ncell + k;
+                if (flagged && flagged[i]) continue;
+
+                const double w = weight ? weight[r * nweight + k % nweight] : 1.0;
+                sums[offset + cellmap[k]] += Acc(data[i]) * w;
+                outweight[offset + cellmap[k]] += w;
+            }
+        }
+    }
+
+    for (size_t i = 0; i < nout; ++i) {
+        out[i] = outweight[i] == 0 ? T(0) : T(sums[i] / outweight[i]);
+    }
+}
+
+// Evaluates a TaQL CALC command, writing the value of its expression for each row into out, which
+// holds n values. Array valued expressions must have the same number of elements for every row,
+// which are written consecutively.
+template<typename T>
+void taqlcalc(const String & command, const std::vector<const Table *> & tables, T * out, size_t n) {
+    const TaQLResult result = tableCommand(command, tables);
+    if (result.isTable()) {
+        throw std::invalid_argument("TaQL command is not a CALC expression");
+    }
+    const TableExprNode node = result.node();
+
+    // Expressions that do not refer to a table are evaluated once
+    const rownr_t nrow = std::max<rownr_t>(node.nrow(), 1);
+    if (n % nrow != 0) {
+        throw std::length_error("Destination size is not a multiple of the number of rows");
+    }
+
+    if (node.isScalar()) {
+        if (n != nrow) throw std::length_error("Destination size does not match the number of rows");
+        for (rownr_t row = 0; row < nrow; ++row) node.get(TableExprId(row), out[row]);
+    } else {
+        const size_t ncell = n / nrow;
+        Array<T> cell;
+        for (rownr_t row = 0; row < nrow; ++row) {
+            node.get(TableExprId(row), cell);
+            if (cell.nelements() != ncell) {
+                throw std::length_error("Expression has a different number of elements for each row");
+            }
+            std::copy(cell.begin(), cell.end(), out + row * ncell);
+        }
+    }
+}
+
 // This function is called repeatedly when adding Measures.
 // We add measures by their base names rather than as parametric types of Measure class.
 // This is due to circular type dependencies in signatures that cause errors in Julia.
@@ -75,6 +900,16 @@ void addmeasure(jlcxx::Module & mod, std::string mname) {
         .method("getValue", [](T & m, size_t i) {
             // This is a cheeky convenience method that avoids allocations in Julia.
             return m.getValue().getVector()[i];
+        })
+        .method("getVector", [](const T & m) {
+            // The full precision packed value (e.g. the day and fraction of an epoch)
+            return m.getValue().getVector();
+        })
+        .method("isplainref", [](const T & m) {
+            // True if the measure's reference has neither an offset nor a frame, in which case
+            // a conversion engine for this measure depends only on its reference type.
+            const typename T::Ref & ref = m.getRef();
+            return ref.offset() == nullptr && ref.getFrame().empty();
         });
 
     mod.template add_type<typename T::Convert>(mname + "!Convert")
@@ -87,9 +922,73 @@ void addmeasure(jlcxx::Module & mod, std::string mname) {
         .method(static_cast<const T & (T::Convert::*)(const Vector<Double> &)>(&T::Convert::operator()))
         .method("setModel", &T::Convert::setModel)
         .method("setOut", static_cast<void (T::Convert::*)(const typename T::Ref &)>(&T::Convert::setOut))
-        .method("convert!", [](typename T::Convert & c, T & min, T & mout) {
+        .method("convert!", [mname](typename T::Convert & c, T & min, T & mout) {
+            const Stopwatch stopwatch(conversionstatsenabled);
             const T & tmp = c(min.getValue());
             mout.set(tmp.getValue(), tmp.getRef());
+            if (stopwatch) recordconversion(mname, 1, stopwatch.seconds());
+        })
+        .method("convert!", [mname](typename T::Convert & c, double * outptr, ssize_t outstride, double * inptr, ssize_t instride, ssize_t n) {
+            // Batched conversion of n packed measure values, avoiding a round trip into Julia per value
+            const Stopwatch stopwatch(conversionstatsenabled);
+            TV mv;
+            for (ssize_t i = 0; i < n; ++i) {
+                unpackvalue(mv, inptr + i * instride, instride);
+                packvalue(c(mv).getValue(), outptr + i * outstride, outstride);
+            }
+            if (stopwatch) recordconversion(mname, n, stopwatch.seconds());
+        })
+        .method("convert!", [mname](const typename T::Convert & c, const MeasFrame & frame, const T & min, typename T::Types outtype, double * outptr, ssize_t outstride, double * mjds, ssize_t n) {
+            // Time series conversion of a fixed measure, where the epoch of a copy of the frame is
+            // stepped in place, leaving the caller's converter and frame untouched. Frame dependent
+            // values are recalculated on reset, but the conversion chain is only set up once.
+            const Stopwatch stopwatch(conversionstatsenabled);
+            MeasFrame localframe = copyframe(frame);
+            typename T::Convert local(c);
+            local.setOut(typename T::Ref(outtype, localframe));
+            local.setModel(min);
+            for (ssize_t i = 0; i < n; ++i) {
+                localframe.resetEpoch(mjds[i]);
+                packvalue(local().getValue(), outptr + i * outstride, outstride);
+            }
+            if (stopwatch) recordconversion(mname, n, stopwatch.seconds());
+        })
+        .method("convert!", [mname](const typename T::Convert & c, const MeasFrame & frame, typename T::Types outtype, double * outptr, ssize_t outstride, double * inptr, ssize_t instride, ssize_t n, ssize_t nthreads) {
+            // Parallel batched conversion, where each thread uses its own copy of the converter
+            // and frame. The input model is still shared, and so must have neither a frame nor
+            // an offset of its own (see isplainref), as casacore fills the caches of such frames
+            // as it converts.
+            const Stopwatch stopwatch(conversionstatsenabled);
+            std::shared_lock<std::shared_mutex> lock(measuresmutex);
+            parallelfor(n, nthreads, [&](size_t start, size_t end) {
+                typename T::Convert local(c);
+                local.setOut(typename T::Ref(outtype, copyframe(frame)));
+
+                TV mv;
+                for (size_t i = start; i < end; ++i) {
+                    unpackvalue(mv, inptr + i * instride, instride);
+                    packvalue(local(mv).getValue(), outptr + i * outstride, outstride);
+                }
+            });
+            if (stopwatch) recordconversion(mname, n, stopwatch.seconds());
+        })
+        .method("convert!", [mname](const typename T::Convert & c, const MeasFrame & frame, const T & min, typename T::Types outtype, double * outptr, ssize_t outstride, double * mjds, ssize_t n, ssize_t nthreads) {
+            // Parallel time series conversion, with the epochs partitioned across threads. As for
+            // batched conversions, min must have neither a frame nor an offset of its own.
+            const Stopwatch stopwatch(conversionstatsenabled);
+            std::shared_lock<std::shared_mutex> lock(measuresmutex);
+            parallelfor(n, nthreads, [&](size_t start, size_t end) {
+                MeasFrame localframe = copyframe(frame);
+                typename T::Convert local(c);
+                local.setOut(typename T::Ref(outtype, localframe));
+                local.setModel(min);
+
+                for (size_t i = start; i < end; ++i) {
+                    localframe.resetEpoch(mjds[i]);
+                    packvalue(local().getValue(), outptr + i * outstride, outstride);
+                }
+            });
+            if (stopwatch) recordconversion(mname, n, stopwatch.seconds());
         });
 
     // Add T::Ref::set() here as we need T to have been defined
@@ -105,6 +1004,63 @@ void addmeasure(jlcxx::Module & mod, std::string mname) {
     });
 }
 
+// Calculate UVW coordinates (ant2 - ant1) for each row of an observation, in the frame of phasecentre.
+// Following casacore's MSUVWGenerator, each antenna's baseline relative to the first antenna is
+// converted and projected just once per unique time, and row UVWs are formed from their differences.
+// Unique times are partitioned across up to nthreads, each with its own frame and conversion engine.
+void calcuvws(
+    double * uvws, double * positions, ssize_t nant, int64_t * ant1, int64_t * ant2,
+    double * times, ssize_t nrow, const MDirection & phasecentre, ssize_t nthreads
+) {
+    if (nrow == 0) return;
+
+    // Group rows by time, as [start, end) ranges into order
+    std::vector<ssize_t> order(nrow);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](ssize_t a, ssize_t b) {
+        return times[a] < times[b];
+    });
+
+    std::vector<std::pair<ssize_t, ssize_t>> groups;
+    for (ssize_t start = 0, end = 0; start < nrow; start = end) {
+        while (end < nrow && times[order[end]] == times[order[start]]) ++end;
+        groups.emplace_back(start, end);
+    }
+
+    const MPosition refpos(MVPosition(positions[0], positions[1], positions[2]), MPosition::ITRF);
+    const MBaseline::Types bltype = MBaseline::castType(phasecentre.getRef().getType());
+    const MVDirection phasedir = phasecentre.getValue();
+
+    auto worker = [&](size_t gstart, size_t gend) {
+        MEpoch epoch(MVEpoch(times[order[groups[gstart].first]] / 86400.), MEpoch::UTC);
+        MeasFrame frame(refpos, epoch, phasecentre);
+        MBaseline::Convert convert(MBaseline::Ref(MBaseline::ITRF, frame), MBaseline::Ref(bltype, frame));
+
+        std::vector<std::array<double, 3>> antuvws(nant);
+        for (size_t g = gstart; g < gend; ++g) {
+            frame.resetEpoch(times[order[groups[g].first]] / 86400.);
+
+            for (ssize_t a = 0; a < nant; ++a) {
+                const double * pos = positions + 3 * a;
+                MVBaseline baseline(pos[0] - positions[0], pos[1] - positions[1], pos[2] - positions[2]);
+                MVuvw uvw(convert(baseline).getValue(), phasedir);
+                const Vector<double> & value = uvw.getValue();
+                antuvws[a] = {value(0), value(1), value(2)};
+            }
+
+            for (ssize_t i = groups[g].first; i < groups[g].second; ++i) {
+                const ssize_t row = order[i];
+                for (size_t j = 0; j < 3; ++j) {
+                    uvws[3 * row + j] = antuvws[ant2[row]][j] - antuvws[ant1[row]][j];
+                }
+            }
+        }
+    };
+
+    std::shared_lock<std::shared_mutex> lock(measuresmutex);
+    parallelfor(groups.size(), nthreads, worker);
+}
+
 // Define super types to allow upcasting, which in turn allows class hierarchies
 namespace jlcxx {
     template<> struct SuperType<JuliaState> { typedef AppState type; };
@@ -119,6 +1075,14 @@ namespace jlcxx {
     template<> struct SuperType<MPosition> { typedef Measure type; };
     template<> struct SuperType<MRadialVelocity> { typedef Measure type; };
     template<> struct SuperType<Muvw> { typedef Measure type; };
+    template<> struct SuperType<StandardStMan> { typedef DataManager type; };
+    template<> struct SuperType<IncrementalStMan> { typedef DataManager type; };
+    template<> struct SuperType<TiledColumnStMan> { typedef DataManager type; };
+    template<> struct SuperType<TiledShapeStMan> { typedef DataManager type; };
+    template<> struct SuperType<TiledCellStMan> { typedef DataManager type; };
+    template<> struct SuperType<CompressComplex> { typedef DataManager type; };
+    template<> struct SuperType<CompressComplexSD> { typedef DataManager type; };
+    template<> struct SuperType<CompressFloat> { typedef DataManager type; };
 }
 
 JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
@@ -132,10 +1096,19 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
     mod.add_type<AppState>("AppState");
 
     mod.add_type<JuliaState>("JuliaState", jlcxx::julia_base_type<AppState>())
-        .constructor<std::string>();
+        .constructor<std::string>()
+        .method("measuresDir", &JuliaState::measuresDir)
+        .method("setMeasuresDir!", [](JuliaState & state, std::string measuresDir) {
+            std::unique_lock<std::shared_mutex> lock(measuresmutex);
+            state.setMeasuresDir(measuresDir);
+        });
+
+    mod.method("snapshotmeasures", &snapshotmeasures);
+    mod.method("preloadmeasures", &preloadmeasures);
 
     mod.add_type<AppStateSource>("AppStateSource")
         .method("initialize", [](AppState& appstate) {
+            std::unique_lock<std::shared_mutex> lock(measuresmutex);
             AppStateSource::initialize(&appstate);
         });
 
@@ -234,6 +1207,14 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
             wrapped.method("getStorage", static_cast<const T * (WrappedT::*)(bool &) const>(&WrappedT::getStorage));
             wrapped.method("freeStorage", &WrappedT::freeStorage);
             wrapped.method("set", &WrappedT::set);
+            if constexpr (!std::is_same<T, String>::value) {
+                // Pointer to the storage, for wrapping as a Julia array without copying. Arrays
+                // whose storage is not contiguous (e.g. slices) first reference a contiguous copy.
+                wrapped.method("data!", [](WrappedT & arr) -> void * {
+                    if (!arr.contiguousStorage()) arr.reference(arr.copy());
+                    return arr.data();
+                });
+            }
             wrapped.method("copy!", [](WrappedT & dest, const jlcxx::ArrayRef<jl_value_t*> src) {
                 auto srciter = src.begin();
                 auto destend = dest.end();
@@ -248,6 +1229,15 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
                     dest.push_back(jlcxx::box<T>(*srciter));
                 };
             });
+            if constexpr (std::is_same<T, String>::value) {
+                wrapped.method("nbytes", [](const WrappedT & src) { return nbytes(src); });
+                wrapped.method("packstrings!", [](const WrappedT & src, unsigned char * bytes, int64_t * offsets) {
+                    packstrings(src, bytes, offsets);
+                });
+                wrapped.method("unpackstrings!", [](WrappedT & dest, const unsigned char * bytes, const int64_t * offsets) {
+                    unpackstrings(dest, bytes, offsets);
+                });
+            }
         });
 
     mod.add_type<jlcxx::Parametric<jlcxx::TypeVar<1>>>("Array")
@@ -278,6 +1268,14 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
             wrapped.method("getStorage", static_cast<const T * (WrappedT::*)(bool &) const>(&WrappedT::getStorage));
             wrapped.method("freeStorage", &WrappedT::freeStorage);
             wrapped.method("set", &WrappedT::set);
+            if constexpr (!std::is_same<T, String>::value) {
+                // Pointer to the storage, for wrapping as a Julia array without copying. Arrays
+                // whose storage is not contiguous (e.g. slices) first reference a contiguous copy.
+                wrapped.method("data!", [](WrappedT & arr) -> void * {
+                    if (!arr.contiguousStorage()) arr.reference(arr.copy());
+                    return arr.data();
+                });
+            }
             wrapped.method("copy!", [](WrappedT & dest, const jlcxx::ArrayRef<jl_value_t*> src) {
                 auto srciter = src.begin();
                 auto destend = dest.end();
@@ -292,6 +1290,15 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
                     dest.push_back(jlcxx::box<T>(*srciter));
                 };
             });
+            if constexpr (std::is_same<T, String>::value) {
+                wrapped.method("nbytes", [](const WrappedT & src) { return nbytes(src); });
+                wrapped.method("packstrings!", [](const WrappedT & src, unsigned char * bytes, int64_t * offsets) {
+                    packstrings(src, bytes, offsets);
+                });
+                wrapped.method("unpackstrings!", [](WrappedT & dest, const unsigned char * bytes, const int64_t * offsets) {
+                    unpackstrings(dest, bytes, offsets);
+                });
+            }
         });
 
     /*
@@ -381,18 +1388,54 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
     mod.add_type<RowNumbers>("RowNumbers")
         .constructor<const Vector<rownr_t> &>();
 
+    mod.add_type<RefRows>("RefRows")
+        .constructor([](const int64_t * rows, ssize_t n) {
+            // Copies the row numbers, collapsing runs of adjacent rows into ranges so that storage
+            // managers can read them together
+            Vector<rownr_t> rownrs(IPosition(1, n));
+            std::copy_n(rows, n, rownrs.data());
+            return new RefRows(RowNumbers(rownrs), False, True);
+        })
+        .method("nrow", &RefRows::nrow);
+
     mod.add_type<TableRecord>("TableRecord")
         .method("name", &TableRecord::name)
         .method("type", &TableRecord::type)
         .method("size", &TableRecord::size)
         .method("fieldNumber", &TableRecord::fieldNumber);
 
-    mod.add_type<TSMOption>("TSMOption");
+    mod.add_bits<TSMOption::Option>("TSMOptionKind", jlcxx::julia_type("CppEnum"));
+    mod.set_const("TSMCache", TSMOption::Cache);
+    mod.set_const("TSMBuffer", TSMOption::Buffer);
+    mod.set_const("TSMMMap", TSMOption::MMap);
+    mod.set_const("TSMDefault", TSMOption::Default);
+    mod.set_const("TSMAipsrc", TSMOption::Aipsrc);
+
+    // (option, buffer size in bytes or 0 for the default, mmap threshold used by TSMDefault or -1
+    // for the default)
+    mod.add_type<TSMOption>("TSMOption")
+        .constructor<TSMOption::Option, Int, Int>();
 
     mod.add_bits<Table::TableOption>("TableOption", jlcxx::julia_type("CppEnum"));
 
+    mod.add_bits<TableLock::LockOption>("LockOption", jlcxx::julia_type("CppEnum"));
+    mod.set_const("PermanentLocking", TableLock::PermanentLocking);
+    mod.set_const("PermanentLockingWait", TableLock::PermanentLockingWait);
+    mod.set_const("AutoLocking", TableLock::AutoLocking);
+    mod.set_const("UserLocking", TableLock::UserLocking);
+    mod.set_const("AutoNoReadLocking", TableLock::AutoNoReadLocking);
+    mod.set_const("UserNoReadLocking", TableLock::UserNoReadLocking);
+    mod.set_const("NoLocking", TableLock::NoLocking);
+    mod.set_const("DefaultLocking", TableLock::DefaultLocking);
+
+    mod.add_bits<FileLocker::LockType>("LockType", jlcxx::julia_type("CppEnum"));
+    mod.set_const("ReadLock", FileLocker::Read);
+    mod.set_const("WriteLock", FileLocker::Write);
+
     mod.add_type<TableLock>("TableLock")
-        .constructor<const TableLock &>();
+        .constructor<const TableLock &>()
+        // (option, inspection interval in seconds, maximum wait in seconds or 0 to wait forever)
+        .constructor<TableLock::LockOption, double, uInt>();
 
     mod.add_bits<Table::TableType>("TableType", jlcxx::julia_type("CppEnum"));
     mod.set_const("Plain", Table::Plain);
@@ -405,10 +1448,45 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
         .method("columnDesc", static_cast<const ColumnDesc & (TableDesc::*)(const String &) const>(&TableDesc::columnDesc))
         .method("columnDescSet", &TableDesc::columnDescSet);
 
+    mod.add_type<DataManager>("DataManager")
+        .method("dataManagerType", &DataManager::dataManagerType)
+        .method("dataManagerName", &DataManager::dataManagerName);
+
+    mod.add_type<StandardStMan>("StandardStMan", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, Int, uInt>();
+
+    mod.add_type<IncrementalStMan>("IncrementalStMan", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, uInt, Bool, uInt>();
+
+    // The tiled storage managers take (hypercolumn name, tile shape, maximum cache size in MiB)
+    mod.add_type<TiledColumnStMan>("TiledColumnStMan", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, const IPosition &, uInt64>();
+
+    mod.add_type<TiledShapeStMan>("TiledShapeStMan", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, const IPosition &, uInt64>();
+
+    mod.add_type<TiledCellStMan>("TiledCellStMan", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, const IPosition &, uInt64>();
+
+    // The compression engines take (virtual column name, stored column name) followed by either a
+    // fixed (scale, offset), or the names of the scale and offset columns and whether to autoscale
+    mod.add_type<CompressComplex>("CompressComplex", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, const String &, Float, Float>()
+        .constructor<const String &, const String &, const String &, const String &, Bool>();
+
+    mod.add_type<CompressComplexSD>("CompressComplexSD", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, const String &, Float, Float>()
+        .constructor<const String &, const String &, const String &, const String &, Bool>();
+
+    mod.add_type<CompressFloat>("CompressFloat", jlcxx::julia_base_type<DataManager>())
+        .constructor<const String &, const String &, Float, Float>()
+        .constructor<const String &, const String &, const String &, const String &, Bool>();
+
     mod.add_type<Table>("Table")
         .constructor()
         .constructor<const Table &>() // copy
         .constructor<Table::TableType>()
+        .constructor<Table::TableType, const TSMOption &>()
         .constructor<const String &>()
         .constructor<const String &, Table::TableOption>()
         .constructor<const String &, Table::TableOption, const TSMOption &>()
@@ -420,7 +1498,10 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
         .method("tableDesc", &Table::tableDesc)
         .method("flush", &Table::flush)
         .method("unlock", &Table::unlock)
+        .method("lock", static_cast<Bool (Table::*)(FileLocker::LockType, uInt)>(&Table::lock))
+        .method("hasLock", static_cast<Bool (Table::*)(FileLocker::LockType) const>(&Table::hasLock))
         .method("addColumn", static_cast<void (Table::*)(const ColumnDesc &, Bool)>(&Table::addColumn))
+        .method("addColumn", static_cast<void (Table::*)(const ColumnDesc &, const DataManager &, Bool)>(&Table::addColumn))
         .method("removeColumn", static_cast<void (Table::*)(const String &)>(&Table::removeColumn))
         .method("addRow", &Table::addRow)
         .method("removeRow", static_cast<void (Table::*)(rownr_t)>(&Table::removeRow))
@@ -441,6 +1522,98 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
 
     mod.method("deleteSubTable", &TableUtil::deleteSubTable);
 
+    // Concatenates the rows of tables with the same columns into a single (ConcatTable) view
+    mod.method("concatTables", [](std::vector<const Table*> tables) {
+        Block<Table> parts(tables.size());
+        for (size_t i = 0; i < tables.size(); ++i) parts[i] = *tables[i];
+        return Table(parts);
+    });
+
+    // Column I/O instrumentation. Stats are recorded per table (by name) and column, and written
+    // by iostats!() as the get calls, bytes and seconds, followed by the same for puts.
+    mod.method("setiostats!", [](bool enabled) { iostatsenabled = enabled; });
+    mod.method("iostatsenabled", []() { return iostatsenabled.load(); });
+    mod.method("iostatscolumns", [](const Table & table) {
+        const std::string name = table.tableName();
+        std::vector<std::string> columns;
+        std::lock_guard<std::mutex> lock(statsmutex);
+        for (const auto & [key, stats] : iostats) {
+            if (key.first == name) columns.push_back(key.second);
+        }
+        return columns;
+    });
+    mod.method("iostats!", [](const Table & table, const std::string & column, double * out) {
+        std::lock_guard<std::mutex> lock(statsmutex);
+        const auto it = iostats.find({table.tableName(), column});
+        const IOStats stats = it == iostats.end() ? IOStats() : it->second;
+        for (size_t put = 0; put < 2; ++put) {
+            out[3 * put] = stats.calls[put];
+            out[3 * put + 1] = stats.bytes[put];
+            out[3 * put + 2] = stats.seconds[put];
+        }
+    });
+    mod.method("resetiostats!", [](const Table & table) {
+        const std::string name = table.tableName();
+        std::lock_guard<std::mutex> lock(statsmutex);
+        for (auto it = iostats.begin(); it != iostats.end();) {
+            it = it->first.first == name ? iostats.erase(it) : std::next(it);
+        }
+    });
+    mod.method("resetiostats!", []() {
+        std::lock_guard<std::mutex> lock(statsmutex);
+        iostats.clear();
+    });
+
+    // Constructed by column name (byColumn = True), this accesses the tiled storage manager that
+    // holds the given column. Cache settings apply to all columns bound to that manager and last
+    // for the lifetime of the open table only. Cache sizes are in MiB.
+    mod.add_type<ROTiledStManAccessor>("ROTiledStManAccessor")
+        .constructor<const Table &, const String &, Bool>()
+        .method("maximumCacheSize", &ROTiledStManAccessor::maximumCacheSize)
+        .method("setMaximumCacheSize", &ROTiledStManAccessor::setMaximumCacheSize)
+        .method("cacheSize", &ROTiledStManAccessor::cacheSize)
+        .method("bucketSize", &ROTiledStManAccessor::bucketSize)
+        .method("tileShape", &ROTiledStManAccessor::tileShape)
+        .method("hypercubeShape", &ROTiledStManAccessor::hypercubeShape)
+        .method("nhypercubes", &ROTiledStManAccessor::nhypercubes)
+        .method("clearCaches", &ROTiledStManAccessor::clearCaches);
+
+    mod.add_bits<TableIterator::Order>("IteratorOrder", jlcxx::julia_type("CppEnum"));
+    mod.set_const("IteratorAscending", TableIterator::Ascending);
+    mod.set_const("IteratorDescending", TableIterator::Descending);
+
+    mod.add_bits<TableIterator::Option>("IteratorOption", jlcxx::julia_type("CppEnum"));
+    mod.set_const("IteratorParSort", TableIterator::ParSort);
+    mod.set_const("IteratorNoSort", TableIterator::NoSort);
+
+    mod.add_type<TableIterator>("TableIterator")
+        .constructor([](const Table & table, const std::vector<std::string> & keys, TableIterator::Order order, TableIterator::Option option) {
+            Block<String> names(keys.size());
+            std::copy(keys.begin(), keys.end(), names.begin());
+            return new TableIterator(table, names, order, option);
+        })
+        .method("table", [](const TableIterator & it) { return it.table(); })
+        .method("pastEnd", &TableIterator::pastEnd)
+        .method("next!", [](TableIterator & it) { it.next(); })
+        .method("reset!", &TableIterator::reset);
+
+    mod.add_type<ChunkReader>("ChunkReader")
+        .method("prefetch!", &ChunkReader::prefetch)
+        .method("wait!", &ChunkReader::wait);
+
+    mod.add_type<ParallelReader>("ParallelReader")
+        .constructor<size_t>()
+        .method("run!", &ParallelReader::run);
+
+    mod.add_type<RowAppender>("RowAppender")
+        .constructor<const Table &>()
+        .method("appendrows!", &RowAppender::append)
+        .method("removerows!", &RowAppender::removerows);
+
+    mod.add_type<WriteQueue>("WriteQueue")
+        .constructor<size_t>()
+        .method("wait!", &WriteQueue::wait);
+
     mod.add_type<jlcxx::Parametric<jlcxx::TypeVar<1>>>("ScalarColumn")
         .apply<
             ScalarColumn<Bool>,
@@ -464,22 +1637,68 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
             wrapped.method("nrow", &TableColumn::nrow);
             wrapped.method("shapeColumn", &TableColumn::shapeColumn);
             wrapped.method("fillColumn", &WrappedT::fillColumn);
-            wrapped.method("getindex", &WrappedT::operator());
-            wrapped.method("put", static_cast<void (WrappedT::*)(rownr_t, const T &)>(&WrappedT::put));
+            wrapped.method("getindex", instrumented<T>(&WrappedT::operator()));
+            wrapped.method("put", instrumented<T>(static_cast<void (WrappedT::*)(rownr_t, const T &)>(&WrappedT::put)));
             wrapped.method("getColumn", [](const WrappedT & wrappedT) { return wrappedT.getColumn(); });
             wrapped.method(
                 "getColumnRange",
-                static_cast<Vector<T> (WrappedT::*)(const Slicer &) const>(&WrappedT::getColumnRange)
+                instrumented<T>(static_cast<Vector<T> (WrappedT::*)(const Slicer &) const>(&WrappedT::getColumnRange))
             );
             wrapped.method(
                 "getColumnRange",
-                static_cast<void (WrappedT::*)(const Slicer &, Vector<T> &, Bool) const>(&WrappedT::getColumnRange)
+                instrumented<T>(static_cast<void (WrappedT::*)(const Slicer &, Vector<T> &, Bool) const>(&WrappedT::getColumnRange))
             );
-            wrapped.method("putColumn", static_cast<void (WrappedT::*)(const Vector<T> &)>(&WrappedT::putColumn));
+            wrapped.method("putColumn", instrumented<T>(static_cast<void (WrappedT::*)(const Vector<T> &)>(&WrappedT::putColumn)));
             wrapped.method(
                 "putColumnRange",
-                static_cast<void (WrappedT::*)(const Slicer &, const Vector<T> &)>(&WrappedT::putColumnRange)
+                instrumented<T>(static_cast<void (WrappedT::*)(const Slicer &, const Vector<T> &)>(&WrappedT::putColumnRange))
+            );
+            wrapped.method(
+                "getColumnCells",
+                instrumented<T>(static_cast<Vector<T> (WrappedT::*)(const RefRows &) const>(&WrappedT::getColumnCells))
+            );
+            wrapped.method(
+                "getColumnCells",
+                instrumented<T>(static_cast<void (WrappedT::*)(const RefRows &, Vector<T> &, Bool) const>(&WrappedT::getColumnCells))
             );
+            wrapped.method(
+                "putColumnCells",
+                instrumented<T>(static_cast<void (WrappedT::*)(const RefRows &, const Vector<T> &)>(&WrappedT::putColumnCells))
+            );
+            if constexpr (!std::is_same<T, String>::value) {
+                wrapped.method("addreader!", [](ChunkReader & reader, const WrappedT & col, void * buffer0, void * buffer1) {
+                    const std::array<T *, 2> buffers{static_cast<T *>(buffer0), static_cast<T *>(buffer1)};
+                    reader.add([col, buffers](rownr_t start, rownr_t n, size_t b) {
+                        Vector<T> dest(IPosition(1, n), buffers[b], SHARE);
+                        col.getColumnRange(Slicer(IPosition(1, start), IPosition(1, n)), dest, False);
+                    });
+                });
+                wrapped.method("addreader!", [](ParallelReader & reader, const WrappedT & col, void * buffer) {
+                    reader.add(col.table(), [col, buffer]() {
+                        Vector<T> dest(IPosition(1, col.nrow()), static_cast<T *>(buffer), SHARE);
+                        col.getColumn(dest, False);
+                    });
+                });
+                wrapped.method("addwriter!", [](RowAppender & appender, const WrappedT & col, void * buffer) {
+                    appender.add([col, buffer](rownr_t start, rownr_t n) mutable {
+                        const Vector<T> src(IPosition(1, n), static_cast<T *>(buffer), SHARE);
+                        col.putColumnRange(Slicer(IPosition(1, start), IPosition(1, n)), src);
+                    });
+                });
+                wrapped.method("enqueueput!", [](WriteQueue & queue, const WrappedT & col, const Slicer & rows, const Vector<T> & src) {
+                    queue.enqueue([col, rows, data = src.copy()]() mutable {
+                        col.putColumnRange(rows, data);
+                    }, src.nelements() * sizeof(T));
+                });
+                wrapped.method("enqueueput!", [](WriteQueue & queue, const WrappedT & col, const RefRows & rows, const Vector<T> & src) {
+                    queue.enqueue([col, rows, data = src.copy()]() mutable {
+                        col.putColumnCells(rows, data);
+                    }, src.nelements() * sizeof(T));
+                });
+                wrapped.method("statistics!", [](const WrappedT & col, const String & flagname, rownr_t chunkrows, double * out) {
+                    columnstatistics(col, flagname, chunkrows, out);
+                });
+            }
         });
 
     mod.add_type<jlcxx::Parametric<jlcxx::TypeVar<1>>>("ArrayColumn")
@@ -509,29 +1728,159 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
             wrapped.method("shape", &WrappedT::shape);
             wrapped.method("shapeColumn", &TableColumn::shapeColumn);
             wrapped.method("fillColumn", &WrappedT::fillColumn);
-            wrapped.method("get", static_cast<Array<T> (WrappedT::*)(rownr_t) const>(&WrappedT::get));
-            wrapped.method("get", static_cast<void (WrappedT::*)(rownr_t, Array<T> &, Bool) const>(&WrappedT::get));
+            wrapped.method("get", instrumented<T>(static_cast<Array<T> (WrappedT::*)(rownr_t) const>(&WrappedT::get)));
+            wrapped.method("get", instrumented<T>(static_cast<void (WrappedT::*)(rownr_t, Array<T> &, Bool) const>(&WrappedT::get)));
             wrapped.method("getColumn", [](const WrappedT & wrappedT) { return wrappedT.getColumn(); });
             wrapped.method(
                 "getColumnRange",
-                static_cast<Array<T> (WrappedT::*)(const Slicer &, const Slicer &) const>(&WrappedT::getColumnRange)
+                instrumented<T>(static_cast<Array<T> (WrappedT::*)(const Slicer &, const Slicer &) const>(&WrappedT::getColumnRange))
             );
             wrapped.method(
                 "getColumnRange",
-                static_cast<void (WrappedT::*)(const Slicer &, const Slicer &, Array<T> &, Bool) const>(&WrappedT::getColumnRange)
+                instrumented<T>(static_cast<void (WrappedT::*)(const Slicer &, const Slicer &, Array<T> &, Bool) const>(&WrappedT::getColumnRange))
             );
-            wrapped.method("put", static_cast<void (WrappedT::*)(rownr_t, const Array<T> &)>(&WrappedT::put));
-            wrapped.method("putColumn", static_cast<void (WrappedT::*)(const Array<T> &)>(&WrappedT::putColumn));
+            wrapped.method("put", instrumented<T>(static_cast<void (WrappedT::*)(rownr_t, const Array<T> &)>(&WrappedT::put)));
+            wrapped.method("putColumn", instrumented<T>(static_cast<void (WrappedT::*)(const Array<T> &)>(&WrappedT::putColumn)));
             wrapped.method(
                 "putColumnRange",
-                static_cast<void (WrappedT::*)(const Slicer &, const Slicer &, const Array<T> &)>(&WrappedT::putColumnRange)
+                instrumented<T>(static_cast<void (WrappedT::*)(const Slicer &, const Slicer &, const Array<T> &)>(&WrappedT::putColumnRange))
+            );
+            wrapped.method(
+                "getColumnCells",
+                instrumented<T>(static_cast<Array<T> (WrappedT::*)(const RefRows &, const Slicer &) const>(&WrappedT::getColumnCells))
             );
+            wrapped.method(
+                "getColumnCells",
+                instrumented<T>(static_cast<void (WrappedT::*)(const RefRows &, const Slicer &, Array<T> &, Bool) const>(&WrappedT::getColumnCells))
+            );
+            wrapped.method(
+                "putColumnCells",
+                instrumented<T>(static_cast<void (WrappedT::*)(const RefRows &, const Slicer &, const Array<T> &)>(&WrappedT::putColumnCells))
+            );
+            if constexpr (!std::is_same<T, String>::value) {
+                // Fixed shape columns only: each buffer holds the cells of n rows
+                wrapped.method("addreader!", [](ChunkReader & reader, const WrappedT & col, void * buffer0, void * buffer1) {
+                    const std::array<T *, 2> buffers{static_cast<T *>(buffer0), static_cast<T *>(buffer1)};
+                    const IPosition cellshape = col.shapeColumn();
+                    reader.add([col, cellshape, buffers](rownr_t start, rownr_t n, size_t b) {
+                        Array<T> dest(cellshape.concatenate(IPosition(1, n)), buffers[b], SHARE);
+                        col.getColumnRange(Slicer(IPosition(1, start), IPosition(1, n)), dest, False);
+                    });
+                });
+                wrapped.method("addreader!", [](ParallelReader & reader, const WrappedT & col, void * buffer) {
+                    const IPosition shape = col.shapeColumn().concatenate(IPosition(1, col.nrow()));
+                    reader.add(col.table(), [col, shape, buffer]() {
+                        Array<T> dest(shape, static_cast<T *>(buffer), SHARE);
+                        col.getColumn(dest, False);
+                    });
+                });
+                wrapped.method("addwriter!", [](RowAppender & appender, const WrappedT & col, void * buffer) {
+                    const IPosition cellshape = col.shapeColumn();
+                    appender.add([col, cellshape, buffer](rownr_t start, rownr_t n) mutable {
+                        const Array<T> src(cellshape.concatenate(IPosition(1, n)), static_cast<T *>(buffer), SHARE);
+                        col.putColumnRange(Slicer(IPosition(1, start), IPosition(1, n)), src);
+                    });
+                });
+                wrapped.method("enqueueput!", [](WriteQueue & queue, const WrappedT & col, const Slicer & rows, const Slicer & cells, const Array<T> & src) {
+                    queue.enqueue([col, rows, cells, data = src.copy()]() mutable {
+                        col.putColumnRange(rows, cells, data);
+                    }, src.nelements() * sizeof(T));
+                });
+                wrapped.method("enqueueput!", [](WriteQueue & queue, const WrappedT & col, const RefRows & rows, const Slicer & cells, const Array<T> & src) {
+                    queue.enqueue([col, rows, cells, data = src.copy()]() mutable {
+                        col.putColumnCells(rows, cells, data);
+                    }, src.nelements() * sizeof(T));
+                });
+                // Fixed shape columns only
+                wrapped.method("statistics!", [](const WrappedT & col, const String & flagname, rownr_t chunkrows, double * out) {
+                    columnstatistics(col, flagname, chunkrows, out);
+                });
+                if constexpr (std::is_floating_point<T>::value || std::is_same<T, Complex>::value || std::is_same<T, DComplex>::value) {
+                    wrapped.method("average!", [](
+                        const WrappedT & col, const String & flagname, const String & weightname,
+                        const IPosition & cellbin, rownr_t rowbin, rownr_t chunkrows, void * out, double * outweight
+                    ) {
+                        averagecolumn(col, flagname, weightname, cellbin, rowbin, chunkrows, static_cast<T *>(out), outweight);
+                    });
+                }
+
+                // Bulk access to cells of variable shape, for the n row numbers in rows. Cells are
+                // packed contiguously (in row order) into a single flat buffer, with their shapes
+                // described by ndims (0 for undefined cells) and a maxdim x n table of shapes.
+                wrapped.method("ndims!", [](const WrappedT & col, const int64_t * rows, ssize_t n, int64_t * ndims) {
+                    int64_t maxdim = 0;
+                    for (ssize_t i = 0; i < n; ++i) {
+                        ndims[i] = col.isDefined(rows[i]) ? col.ndim(rows[i]) : 0;
+                        maxdim = std::max(maxdim, ndims[i]);
+                    }
+                    return maxdim;
+                });
+                wrapped.method("shapes!", [](const WrappedT & col, const int64_t * rows, ssize_t n, int64_t * shapes, ssize_t maxdim) {
+                    for (ssize_t i = 0; i < n; ++i) {
+                        std::fill_n(shapes + i * maxdim, maxdim, 0);
+                        if (!col.isDefined(rows[i])) continue;
+
+                        const IPosition shape = col.shape(rows[i]);
+                        std::copy(shape.begin(), shape.end(), shapes + i * maxdim);
+                    }
+                });
+                wrapped.method("getCells!", [](const WrappedT & col, const int64_t * rows, ssize_t n, void * data, ssize_t capacity) {
+                    const Stopwatch stopwatch(iostatsenabled);
+                    T * ptr = static_cast<T *>(data);
+                    T * const end = ptr + capacity;
+                    for (ssize_t i = 0; i < n; ++i) {
+                        if (!col.isDefined(rows[i])) continue;
+
+                        const IPosition shape = col.shape(rows[i]);
+                        if (ptr + shape.product() > end) {
+                            throw std::length_error("Column cells exceed the size of the destination buffer");
+                        }
+                        Array<T> cell(shape, ptr, SHARE);
+                        col.get(rows[i], cell, False);
+                        ptr += shape.product();
+                    }
+                    if (stopwatch) recordio(col, false, (ptr - static_cast<T *>(data)) * sizeof(T), stopwatch.seconds());
+                });
+                wrapped.method("putCells!", [](WrappedT & col, const int64_t * rows, ssize_t n, const int64_t * ndims, const int64_t * shapes, ssize_t maxdim, void * data) {
+                    const Stopwatch stopwatch(iostatsenabled);
+                    T * ptr = static_cast<T *>(data);
+                    for (ssize_t i = 0; i < n; ++i) {
+                        IPosition shape(ndims[i]);
+                        std::copy_n(shapes + i * maxdim, ndims[i], shape.begin());
+
+                        const Array<T> cell(shape, ptr, SHARE);
+                        col.put(rows[i], cell);
+                        ptr += shape.product();
+                    }
+                    if (stopwatch) recordio(col, true, (ptr - static_cast<T *>(data)) * sizeof(T), stopwatch.seconds());
+                });
+            }
         });
 
     mod.method("tableCommand", [](std::string command, std::vector<const Table*> tables) -> Table {
         return Table(tableCommand(String(command),  tables));
     });
 
+    // Runs a TaQL selection, returning only the numbers of the selected rows in the first table
+    mod.method("taqlrows", [](std::string command, std::vector<const Table*> tables) {
+        const Table selection = tableCommand(String(command), tables).table();
+        const Vector<rownr_t> rows = selection.rowNumbers(*tables.at(0), True);
+        return std::vector<int64_t>(rows.begin(), rows.end());
+    });
+
+    mod.method("taqlcalc!", [](std::string command, std::vector<const Table*> tables, Bool * out, size_t n) {
+        taqlcalc(String(command), tables, out, n);
+    });
+    mod.method("taqlcalc!", [](std::string command, std::vector<const Table*> tables, Int64 * out, size_t n) {
+        taqlcalc(String(command), tables, out, n);
+    });
+    mod.method("taqlcalc!", [](std::string command, std::vector<const Table*> tables, Double * out, size_t n) {
+        taqlcalc(String(command), tables, out, n);
+    });
+    mod.method("taqlcalc!", [](std::string command, std::vector<const Table*> tables, DComplex * out, size_t n) {
+        taqlcalc(String(command), tables, out, n);
+    });
+
     /**
      * MEASURES
      */
@@ -551,7 +1900,9 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
         .constructor()
         .constructor<const Measure &>()
         .constructor<const Measure &, const Measure &>()
-        .constructor<const Measure &, const Measure &, const Measure &>();
+        .constructor<const Measure &, const Measure &, const Measure &>()
+        .method("set", static_cast<void (MeasFrame::*)(const Measure &)>(&MeasFrame::set))
+        .method("resetEpoch", static_cast<void (MeasFrame::*)(Double)>(&MeasFrame::resetEpoch));
 
     mod.add_type<MVBaseline>("MVBaseline")
         .constructor<double, double, double>() // Units: m
@@ -630,6 +1981,31 @@ JLCXX_MODULE define_julia_module(jlcxx::Module &mod) {
     addmeasure<MRadialVelocity, MVRadialVelocity>(mod, "MRadialVelocity");
     addmeasure<Muvw, MVuvw>(mod, "Muvw");
 
+    // Conversion instrumentation, recorded per measure type (e.g. MDirection) and written by
+    // conversionstats!() as the calls, values converted and seconds
+    mod.method("setconversionstats!", [](bool enabled) { conversionstatsenabled = enabled; });
+    mod.method("conversionstatsenabled", []() { return conversionstatsenabled.load(); });
+    mod.method("conversionstatstypes", []() {
+        std::vector<std::string> mnames;
+        std::lock_guard<std::mutex> lock(statsmutex);
+        for (const auto & [mname, stats] : conversionstats) mnames.push_back(mname);
+        return mnames;
+    });
+    mod.method("conversionstats!", [](const std::string & mname, double * out) {
+        std::lock_guard<std::mutex> lock(statsmutex);
+        const auto it = conversionstats.find(mname);
+        const ConversionStats stats = it == conversionstats.end() ? ConversionStats() : it->second;
+        out[0] = stats.calls;
+        out[1] = stats.conversions;
+        out[2] = stats.seconds;
+    });
+    mod.method("resetconversionstats!", []() {
+        std::lock_guard<std::mutex> lock(statsmutex);
+        conversionstats.clear();
+    });
+
+    mod.method("calcuvws", &calcuvws);
+
     // Measure-specific methods
     mod.method("toDoppler", [](const MFrequency & freq, const MVFrequency & rest) {
         return freq.toDoppler(rest);
@@ -125,6 +125,7 @@ getjuliatype(::Type{CxxBool}) = Bool
 getjuliatype(::Type{CxxChar}) = Int8
 getjuliatype(::Type{CxxUChar}) = UInt8
 getjuliatype(::Type{CxxLongLong}) = Int64
+getjuliatype(::Type{CxxULongLong}) = UInt64
 getjuliatype(::Type{String}) = Base.String
 
 @cxxdereference Base.String(x::String) = (unsafe_string ∘ LibCasacore.c_str)(x)
@@ -132,6 +133,72 @@ getjuliatype(::Type{String}) = Base.String
 String(x::Symbol) = (String ∘ Base.String)(x)
 Base.convert(::Type{String}, x) = String(string(x))
 
+# Bulk string transfer between casacore Vector{String}/Array{String} and Julia arrays of strings.
+# Strings cross the boundary as a single byte buffer plus offsets, rather than boxing each element.
+function tostrings(x::Union{Vector{String}, Array{String}})
+    n = length(x)
+    bytes = Base.Vector{UInt8}(undef, nbytes(x))
+    offsets = Base.Vector{Int64}(undef, n + 1)
+    GC.@preserve bytes offsets begin
+        packstrings!(x, pointer(bytes), pointer(offsets))
+    end
+
+    dest = Base.Array{Base.String}(undef, Base.size(x))
+    GC.@preserve bytes begin
+        for i in 1:n
+            dest[i] = unsafe_string(pointer(bytes, offsets[i] + 1), offsets[i + 1] - offsets[i])
+        end
+    end
+    return dest
+end
+
+function fromstrings!(x::Union{Vector{String}, Array{String}}, v::AbstractArray{Base.String})
+    if length(x) != length(v)
+        throw(DimensionMismatch("Cannot copy $(length(v)) strings into array of length $(length(x))"))
+    end
+
+    offsets = Base.Vector{Int64}(undef, length(v) + 1)
+    offsets[1] = 0
+    for (i, str) in enumerate(v)
+        offsets[i + 1] = offsets[i] + ncodeunits(str)
+    end
+
+    bytes = Base.Vector{UInt8}(undef, offsets[end])
+    for (i, str) in enumerate(v)
+        copyto!(bytes, offsets[i] + 1, codeunits(str), 1, ncodeunits(str))
+    end
+
+    GC.@preserve bytes offsets begin
+        unpackstrings!(x, pointer(bytes), pointer(offsets))
+    end
+    return x
+end
+
+"""
+    asarray(x::Union{Vector, Array})
+
+Wrap the storage of the casacore array `x` as a Julia `Array`, without copying. This allows large
+arrays returned by value from casacore (e.g. by `getColumn()`) to be used in place. The Julia
+array shares memory with `x`, so writes to either are visible in both, and keeps `x` alive for as
+long as it is reachable. If `x` references storage owned by another casacore array, that array
+must also remain alive. Arrays of strings are instead copied by `tostrings()`.
+"""
+function asarray(x::Union{Vector{T}, Array{T}}) where T
+    # casacore arrays without dimensions have no elements
+    dims = Base.size(x)
+    if isempty(dims) || any(iszero, dims)
+        return Base.Array{getjuliatype(T)}(undef, isempty(dims) ? (0,) : dims)
+    end
+
+    # Complex and DComplex share the layout of ComplexF32 and ComplexF64, as Bool does of Bool
+    arr = unsafe_wrap(Base.Array, convert(Ptr{getjuliatype(T)}, data!(x)), dims; own=false)
+
+    # arr does not own its memory: its finalizer holds a reference to x, and so x (and its
+    # storage) is kept alive until arr is itself collected
+    finalizer(_ -> (x; nothing), arr)
+    return arr
+end
+
 function Slicer(is::Vararg{Union{Int, OrdinalRange}, N}) where N
     _step(::Int) = 1 # This little function lets us treat indices as ranges
     _step(x) = step(x)
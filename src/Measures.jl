@@ -38,6 +38,89 @@ struct Converter{T, S}
     in::S
     out::S
     cxx_object::T
+    frame::LibCasacore.MeasFrameAllocated  # shared with cxx_object; copied for time series
+    # False if the input model has its own frame or offset, which casacore updates as it converts
+    # and so cannot be shared between threads
+    plainmodel::Bool
+end
+
+Converter(in::S, out::S, cxx_object::T, frame) where {T, S} = Converter{T, S}(in, out, cxx_object, frame, true)
+
+# A small LRU cache of Converters, keyed by input type, output type and the values of the frame
+# measures. Casacore precomputes the conversion chain when constructing a conversion engine,
+# which otherwise dominates the cost of one-off calls to mconvert().
+#
+# The cache lock only guards lookups and insertions. Each cached Converter has its own lock, held
+# whilst it is used, so that conversions with different converters run concurrently.
+mutable struct ConverterCache
+    const lock::ReentrantLock
+    const entries::Dict{Any, Tuple{Converter, ReentrantLock, Int}}  # key => (converter, its lock, last used)
+    capacity::Int
+    tick::Int
+    hits::Int
+    misses::Int
+end
+
+ConverterCache(capacity::Int) = ConverterCache(
+    ReentrantLock(), Dict{Any, Tuple{Converter, ReentrantLock, Int}}(), capacity, 0, 0, 0
+)
+
+const CONVERTER_CACHE = ConverterCache(64)
+
+# Returns the cached (converter, lock) for key, constructing the converter with f() if necessary.
+# The caller must hold cache.lock.
+function Base.get!(f::Function, cache::ConverterCache, key)
+    cache.tick += 1
+    entry = get(cache.entries, key, nothing)
+    if entry !== nothing
+        cache.hits += 1
+        cache.entries[key] = (entry[1], entry[2], cache.tick)
+        return entry[1], entry[2]
+    end
+
+    cache.misses += 1
+    if length(cache.entries) >= cache.capacity
+        delete!(cache.entries, argmin(k -> cache.entries[k][3], keys(cache.entries)))
+    end
+    c = f()
+    entrylock = ReentrantLock()
+    cache.entries[key] = (c, entrylock, cache.tick)
+    return c, entrylock
+end
+
+# Frame measures are keyed on their full precision packed value, rather than on their properties,
+# since the latter may be rounded (e.g. the time of an Epoch is only its whole day).
+_framekey(m::AbstractMeasure) = (typeof(m), m.type, Tuple(LibCasacore.getVector(m.m)))
+
+"""
+    cachestats()
+
+Return the hits, misses, current size and capacity of the Converter cache used by
+`mconvert()` and `mconvert!()`.
+"""
+function cachestats()
+    return lock(CONVERTER_CACHE.lock) do
+        (
+            hits=CONVERTER_CACHE.hits, misses=CONVERTER_CACHE.misses,
+            length=length(CONVERTER_CACHE.entries), capacity=CONVERTER_CACHE.capacity
+        )
+    end
+end
+
+"""
+    emptycache!(; capacity=nothing)
+
+Empty the Converter cache and reset its counters, optionally setting a new capacity.
+"""
+function emptycache!(; capacity::Union{Nothing, Int}=nothing)
+    lock(CONVERTER_CACHE.lock) do
+        empty!(CONVERTER_CACHE.entries)
+        CONVERTER_CACHE.hits = CONVERTER_CACHE.misses = CONVERTER_CACHE.tick = 0
+        if capacity !== nothing
+            CONVERTER_CACHE.capacity = max(capacity, 1)
+        end
+    end
+    return nothing
 end
 
 function mconvert(outtype, in::AbstractMeasure, measures::AbstractMeasure...)
@@ -47,8 +130,17 @@ function mconvert(outtype, in::AbstractMeasure, measures::AbstractMeasure...)
 end
 
 function mconvert!(out::T, in::T, measures::AbstractMeasure...) where {T <: AbstractMeasure}
-    c = Converter(in, out.type, measures...)
-    return mconvert!(out, in, c)
+    # Measures with their own offset or frame (e.g. a Direction relative to a planet) are
+    # converted with a one-off Converter, since their engine depends on more than their type
+    if !(Bool(LibCasacore.isplainref(in.m)) && all(m -> Bool(LibCasacore.isplainref(m.m)), measures))
+        return mconvert!(out, in, Converter(in, out.type, measures...))
+    end
+
+    key = (T, in.type, out.type, map(_framekey, measures))
+    c, entrylock = lock(CONVERTER_CACHE.lock) do
+        get!(() -> Converter(in.type, out.type, measures...), CONVERTER_CACHE, key)
+    end
+    return lock(() -> mconvert!(out, in, c), entrylock)
 end
 
 function mconvert!(out::T, in::T, c::Converter) where {T <: AbstractMeasure}
@@ -58,6 +150,49 @@ function mconvert!(out::T, in::T, c::Converter) where {T <: AbstractMeasure}
     return out
 end
 
+# Batched conversion: each column of `in` holds the packed value of a single measure, in the same
+# layout used by _setdata!() (e.g. direction cosines for Direction, Hz for Frequency). The
+# conversion loop runs entirely in C++, with the results written into the columns of `out`.
+#
+# With `threads > 1`, the columns are partitioned across native threads, each using its own copy
+# of the conversion engine and frame. Converters whose input measure carries its own frame or
+# offset are always run on a single thread, since that frame is updated as it is used. Note that
+# a Converter must not itself be shared across Julia tasks running concurrently.
+function mconvert!(out::AbstractMatrix{Float64}, in::AbstractMatrix{Float64}, c::Converter; threads::Int=1)
+    if size(out, 2) != size(in, 2)
+        throw(DimensionMismatch("Cannot convert $(size(in, 2)) measures into output with $(size(out, 2)) columns"))
+    end
+
+    inarr = convert(Matrix{Float64}, in)
+    outarr = out isa Matrix{Float64} ? out : Matrix{Float64}(undef, size(out))
+
+    GC.@preserve inarr outarr begin
+        if threads > 1 && c.plainmodel
+            LibCasacore.convert!(
+                c.cxx_object, c.frame, Int(c.out),
+                pointer(outarr), size(outarr, 1),
+                pointer(inarr), size(inarr, 1),
+                size(inarr, 2), threads
+            )
+        else
+            LibCasacore.convert!(
+                c.cxx_object,
+                pointer(outarr), size(outarr, 1),
+                pointer(inarr), size(inarr, 1),
+                size(inarr, 2)
+            )
+        end
+    end
+
+    outarr === out || copyto!(out, outarr)
+    return out
+end
+
+mconvert(c::Converter, in::AbstractMatrix{Float64}; kwargs...) = mconvert!(similar(in, Float64), in, c; kwargs...)
+
+# Allow converters to be reused when broadcasting, e.g. mconvert!.(outs, ins, c)
+Base.broadcastable(c::Converter) = Ref(c)
+
 function _setdata!(x::AbstractMeasure, data::AbstractVector{Float64})
     GC.@preserve data begin
         LibCasacore.putVector(x.mv, pointer(data), length(data))
@@ -86,6 +221,274 @@ using .Positions: Position, radius, long, lat
 using .RadialVelocities: RadialVelocity
 using .UVWs: UVW
 
+# Measure types as named by casacore, used as keys of the conversion statistics
+const MEASURE_TYPES = (
+    MBaseline = Baseline,
+    MDirection = Direction,
+    MDoppler = Doppler,
+    MEarthMagnetic = EarthMagnetic,
+    MEpoch = Epoch,
+    MFrequency = Frequency,
+    MPosition = Position,
+    MRadialVelocity = RadialVelocity,
+    Muvw = UVW,
+)
+
+"""
+    instrument!(enabled::Bool=true)
+
+Enable (or disable) recording of the native conversion statistics returned by `stats()`.
+Instrumentation is disabled by default, and costs little more than a flag check per conversion
+call when disabled.
+"""
+function instrument!(enabled::Bool=true)
+    LibCasacore.setconversionstats!(enabled)
+    return nothing
+end
+
+"""
+    stats()
+
+Return the conversions recorded whilst instrumentation is enabled (see `instrument!()`), as a
+Dict mapping each measure type to the number of native conversion `calls`, the number of values
+converted (`conversions`, which exceeds `calls` for batched and time series conversions) and their
+total wall time in `seconds`.
+"""
+function stats()
+    out = Vector{Float64}(undef, 3)
+    return Dict(map(LibCasacore.conversionstatstypes()) do mname
+        GC.@preserve out LibCasacore.conversionstats!(mname, pointer(out))
+        MEASURE_TYPES[Symbol(mname)] => (calls=Int(out[1]), conversions=Int(out[2]), seconds=out[3])
+    end)
+end
+
+"""
+    resetstats!()
+
+Reset the conversion statistics returned by `stats()`.
+"""
+function resetstats!()
+    LibCasacore.resetconversionstats!()
+    return nothing
+end
+
+# Time series conversion: convert the fixed measure `in` at each of `times`, reusing a single
+# copy of the frame and conversion engine and stepping the copied frame's epoch in place, so that
+# `c` itself is left unchanged. The converter must have been constructed with an Epoch in its
+# frame; the type of this Epoch is retained, and `times` are interpreted as days (e.g. MJD) if
+# they are unitless. As for batched conversions, `threads` partitions the epochs across native
+# threads.
+#
+# If `maxerror` is provided, conversions are instead approximated by Chebyshev interpolants
+# fitted to exact conversions on a coarse grid of epochs (see _approxconvert!()).
+function mconvert!(
+    out::AbstractMatrix{Float64}, in::T, c::Converter, times::AbstractVector;
+    threads::Int=1, maxerror=nothing
+) where {T <: AbstractMeasure}
+    @assert(c.in == in.type)
+    if size(out, 2) != length(times)
+        throw(DimensionMismatch("Cannot convert $(length(times)) epochs into output with $(size(out, 2)) columns"))
+    end
+
+    mjds = collect(Float64, _days(t) for t in times)
+    outarr = out isa Matrix{Float64} ? out : Matrix{Float64}(undef, size(out))
+
+    if maxerror === nothing
+        _exactconvert!(outarr, in, c, mjds, threads)
+    else
+        _approxconvert!(outarr, in, c, mjds, _maxerror(T, maxerror), threads)
+    end
+
+    outarr === out || copyto!(out, outarr)
+    return out
+end
+
+function mconvert(
+    outtype, in::T, times::AbstractVector, measures::AbstractMeasure...; kwargs...
+) where {T <: AbstractMeasure}
+    if !any(m -> m isa Epoch, measures)
+        throw(ArgumentError("Time series conversion requires an Epoch as part of the reference frame"))
+    end
+
+    c = Converter(in, outtype, measures...)
+    values = mconvert!(Matrix{Float64}(undef, length(in.cache), length(times)), in, c, times; kwargs...)
+
+    return map(eachcol(values)) do value
+        out = zero(in)
+        out.type = outtype
+        _setdata!(out, value)
+        return out
+    end
+end
+
+function _exactconvert!(out::Matrix{Float64}, in::AbstractMeasure, c::Converter, mjds::Vector{Float64}, threads::Int)
+    GC.@preserve mjds out begin
+        # The input measure becomes the model of each thread's engine, and so a frame or offset
+        # of its own would be shared between threads
+        if threads > 1 && Bool(LibCasacore.isplainref(in.m))
+            LibCasacore.convert!(
+                c.cxx_object, c.frame, in.m, Int(c.out),
+                pointer(out), size(out, 1),
+                pointer(mjds), length(mjds), threads
+            )
+        else
+            LibCasacore.convert!(
+                c.cxx_object, c.frame, in.m, Int(c.out),
+                pointer(out), size(out, 1),
+                pointer(mjds), length(mjds)
+            )
+        end
+    end
+    return out
+end
+
+# Approximate time series conversion for slowly varying conversions (e.g. precession and
+# nutation, or topocentric frequency corrections) over dense grids of epochs.
+#
+# The (sorted) span of epochs is recursively bisected into segments. For each segment, exact
+# conversions are evaluated at CHEBYSHEV_NODES Chebyshev nodes and used to fit an interpolant,
+# which is then verified against exact conversions at the points midway between these nodes. If
+# the maximum absolute error of the packed values exceeds maxerror, the segment is split in two.
+# Segments with too few epochs to benefit from interpolation are converted exactly.
+const CHEBYSHEV_NODES = 8
+
+function _approxconvert!(
+    out::Matrix{Float64}, in::T, c::Converter, mjds::Vector{Float64}, maxerror::Float64, threads::Int
+) where {T <: AbstractMeasure}
+    idxs = sortperm(mjds)
+    segments = [idxs]
+    while !isempty(segments)
+        segment = pop!(segments)
+        t0, t1 = mjds[first(segment)], mjds[last(segment)]
+
+        if length(segment) <= 4 * CHEBYSHEV_NODES || t0 == t1
+            out[:, segment] = _exactconvert!(similar(out, size(out, 1), length(segment)), in, c, mjds[segment], threads)
+            continue
+        end
+
+        # Exact values at the Chebyshev nodes, followed by the check points between them
+        N = CHEBYSHEV_NODES
+        xs = [[cospi((k + 0.5) / N) for k in 0:N - 1]; [cospi(k / N) for k in 1:N - 1]]
+        exact = _exactconvert!(
+            similar(out, size(out, 1), length(xs)), in, c, @.((t0 + t1) / 2 + xs * (t1 - t0) / 2), threads
+        )
+        coeffs = _chebyshevfit(@view exact[:, 1:N])
+
+        value = zeros(size(out, 1))
+        maxdiff = maximum(N + 1:length(xs)) do i
+            _chebyshevinterp!(T, value, coeffs, xs[i])
+            maximum(abs.(value .- @view exact[:, i]))
+        end
+
+        if maxdiff <= maxerror
+            for i in segment
+                _chebyshevinterp!(T, @view(out[:, i]), coeffs, (2 * mjds[i] - t0 - t1) / (t1 - t0))
+            end
+        else
+            mid = searchsortedlast(view(mjds, segment), (t0 + t1) / 2)
+            push!(segments, segment[1:mid], segment[mid + 1:end])
+        end
+    end
+
+    return out
+end
+
+# Chebyshev coefficients of each row of values, as sampled at the Chebyshev nodes
+function _chebyshevfit(values::AbstractMatrix{Float64})
+    N = size(values, 2)
+    coeffs = zeros(size(values, 1), N)
+    for j in 0:N - 1, k in 0:N - 1
+        w = (j == 0 ? 1 : 2) * cospi(j * (k + 0.5) / N) / N
+        @views coeffs[:, j + 1] .+= w .* values[:, k + 1]
+    end
+    return coeffs
+end
+
+# Evaluate the interpolant at x ∈ [-1, 1] using Clenshaw's recurrence
+function _chebyshevinterp!(::Type{<:AbstractMeasure}, out::AbstractVector{Float64}, coeffs::Matrix{Float64}, x::Float64)
+    for i in axes(coeffs, 1)
+        b1 = b2 = 0.0
+        for j in size(coeffs, 2):-1:2
+            b1, b2 = 2x * b1 - b2 + coeffs[i, j], b1
+        end
+        out[i] = x * b1 - b2 + coeffs[i, 1]
+    end
+    return out
+end
+
+# Interpolated direction cosines are renormalised to unit length
+function _chebyshevinterp!(::Type{Direction}, out::AbstractVector{Float64}, coeffs::Matrix{Float64}, x::Float64)
+    _chebyshevinterp!(AbstractMeasure, out, coeffs, x)
+    out ./= sqrt(sum(abs2, out))
+    return out
+end
+
+# Maximum errors are given in the units of the packed values, or as a unitful quantity
+_maxerror(::Type{<:AbstractMeasure}, maxerror::Real) = Float64(maxerror)
+_maxerror(::Type{Direction}, maxerror::U.DimensionlessQuantity) = ustrip(Float64, U.rad, maxerror)
+_maxerror(::Type{Frequency}, maxerror::U.Frequency) = ustrip(Float64, U.Hz, maxerror)
+_maxerror(::Type{UVW}, maxerror::U.Length) = ustrip(Float64, U.m, maxerror)
+_maxerror(::Type{T}, maxerror) where {T <: AbstractMeasure} = throw(ArgumentError("Unsupported maximum error $(maxerror) for $(T) conversions"))
+
+_days(t::Real) = Float64(t)
+_days(t::U.Time) = ustrip(Float64, U.d, t)
+
+"""
+    preload!(start, stop; snapshot=nothing)
+
+Read the measures tables used by conversions of epochs between `start` and `stop` (in days, e.g.
+MJD, if unitless) up front, rather than lazily on the first conversion, and return the time taken
+in seconds. The IERS Earth orientation and leap second tables are read into memory in full, and
+the rows of the JPL ephemerides covering the range are read once.
+
+If `snapshot` is a path, the measures tables are instead read from a compact copy at that path,
+in which the daily IERS tables are restricted to the requested range. The snapshot is created from
+the bundled measures data if it does not already exist, so that many processes can share one copy.
+Conversions of epochs outside the snapshot's range lack Earth orientation data, and so are less
+accurate.
+
+Tables that have already been read (e.g. by earlier conversions) are not reread from a snapshot,
+so this should be called before any conversions. Setting the `CASACORE_MEASURES_PRELOAD`
+environment variable to `start:stop` (and, optionally, `CASACORE_MEASURES_SNAPSHOT` to a path)
+preloads the tables when Casacore is loaded.
+"""
+function preload!(start, stop; snapshot::Union{Nothing, AbstractString}=nothing)
+    start, stop = _days(start), _days(stop)
+    if start > stop
+        throw(ArgumentError("Preload range must have start <= stop"))
+    end
+
+    if snapshot !== nothing
+        snapshot = abspath(snapshot)
+        ispath(snapshot) || _snapshot(snapshot, start, stop)
+        LibCasacore.setMeasuresDir!(LibCasacore.juliastate, snapshot)
+    end
+    return LibCasacore.preloadmeasures(start, stop)
+end
+
+# The snapshot is written to a temporary directory and then moved into place, so that processes
+# creating the same snapshot concurrently never see a partial copy.
+function _snapshot(path::AbstractString, start::Float64, stop::Float64)
+    mkpath(dirname(path))
+    tmp = mktempdir(dirname(path); prefix=".$(basename(path))-", cleanup=false)
+    try
+        LibCasacore.snapshotmeasures(LibCasacore.measuresDir(LibCasacore.juliastate), tmp, start, stop)
+        mv(tmp, path)
+    catch
+        rm(tmp; recursive=true, force=true)
+        ispath(path) || rethrow()
+    end
+    return path
+end
+
+function __init__()
+    if haskey(ENV, "CASACORE_MEASURES_PRELOAD")
+        start, stop = parse.(Float64, split(ENV["CASACORE_MEASURES_PRELOAD"], ':'))
+        seconds = preload!(start, stop; snapshot=get(ENV, "CASACORE_MEASURES_SNAPSHOT", nothing))
+        @info "Preloaded measures tables for MJD $(start) to $(stop) in $(round(seconds; digits=3)) s"
+    end
+end
+
 # Define some adhoc constructors for Measures that need to be defined late to avoid cyclic
 # type dependencies
 import .Dopplers
@@ -105,22 +105,21 @@ function Base.setproperty!(x::Baseline, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MBaseline!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MBaseline!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MBaseline!Convert(Int(in), ref)
+        in, out, LibCasacore.MBaseline!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::Baseline, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MBaseline!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MBaseline!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MBaseline!Convert(in.m, ref)
+        in.type, out, LibCasacore.MBaseline!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
@@ -124,22 +124,21 @@ function Base.setproperty!(x::Direction, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MDirection!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MDirection!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MDirection!Convert(Int(in), ref)
+        in, out, LibCasacore.MDirection!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::Direction, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MDirection!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MDirection!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MDirection!Convert(in.m, ref)
+        in.type, out, LibCasacore.MDirection!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
@@ -80,22 +80,21 @@ function Base.setproperty!(x::Doppler, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MDoppler!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MDoppler!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MDoppler!Convert(Int(in), ref)
+        in, out, LibCasacore.MDoppler!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::Doppler, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MDoppler!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MDoppler!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MDoppler!Convert(in.m, ref)
+        in.type, out, LibCasacore.MDoppler!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
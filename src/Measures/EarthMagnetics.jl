@@ -109,22 +109,21 @@ function Base.setproperty!(x::EarthMagnetic, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MEarthMagnetic!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MEarthMagnetic!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MEarthMagnetic!Convert(Int(in), ref)
+        in, out, LibCasacore.MEarthMagnetic!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::EarthMagnetic, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MEarthMagnetic!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MEarthMagnetic!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MEarthMagnetic!Convert(in.m, ref)
+        in.type, out, LibCasacore.MEarthMagnetic!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
@@ -89,22 +89,21 @@ function Base.setproperty!(x::Epoch, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MEpoch!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MEpoch!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MEpoch!Convert(Int(in), ref)
+        in, out, LibCasacore.MEpoch!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::Epoch, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MEpoch!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MEpoch!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MEpoch!Convert(in.m, ref)
+        in.type, out, LibCasacore.MEpoch!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
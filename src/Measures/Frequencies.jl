@@ -77,22 +77,21 @@ function Base.setproperty!(x::Frequency, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MFrequency!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MFrequency!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MFrequency!Convert(Int(in), ref)
+        in, out, LibCasacore.MFrequency!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::Frequency, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MFrequency!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MFrequency!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MFrequency!Convert(in.m, ref)
+        in.type, out, LibCasacore.MFrequency!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
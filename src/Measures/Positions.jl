@@ -129,22 +129,21 @@ function lat(d::Position)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MPosition!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MPosition!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MPosition!Convert(Int(in), ref)
+        in, out, LibCasacore.MPosition!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::Position, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MPosition!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MPosition!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MPosition!Convert(in.m, ref)
+        in.type, out, LibCasacore.MPosition!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
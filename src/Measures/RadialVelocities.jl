@@ -72,22 +72,21 @@ function Base.setproperty!(x::RadialVelocity, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MRadialVelocity!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MRadialVelocity!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.MRadialVelocity!Convert(Int(in), ref)
+        in, out, LibCasacore.MRadialVelocity!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::RadialVelocity, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.MRadialVelocity!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.MRadialVelocity!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.MRadialVelocity!Convert(in.m, ref)
+        in.type, out, LibCasacore.MRadialVelocity!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
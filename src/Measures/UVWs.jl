@@ -105,23 +105,67 @@ function Base.setproperty!(x::UVW, name::Symbol, v)
 end
 
 function Converter(in::Types, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.Muvw!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.Muvw!Ref(Int(out), frame)
 
     return Converter(
-        in, out, LibCasacore.Muvw!Convert(Int(in), ref)
+        in, out, LibCasacore.Muvw!Convert(Int(in), ref), frame
     )
 end
 
 function Converter(in::UVW, out::Types, measures::AbstractMeasure...)
-    ref = LibCasacore.Muvw!Ref(
-        Int(out), LibCasacore.MeasFrame((m.m for m in measures)...)
-    )
+    frame = LibCasacore.MeasFrame((m.m for m in measures)...)
+    ref = LibCasacore.Muvw!Ref(Int(out), frame)
 
     return Converter(
-        in.type, out, LibCasacore.Muvw!Convert(in.m, ref)
+        in.type, out, LibCasacore.Muvw!Convert(in.m, ref), frame,
+        Bool(LibCasacore.isplainref(in.m))
     )
 end
 
-end
\ No newline at end of file
+# Calculate UVW coordinates (ant2 - ant1, in metres) for each row of an observation, writing
+# these into the columns of `out` (3 x nrow). `positions` are antenna ITRF positions (3 x nant,
+# in metres), `ant1` and `ant2` are 1-based antenna indices into `positions`, and `times` are
+# UTC MJD in seconds, as stored in the TIME column of a MeasurementSet. UVWs are returned in the
+# frame of `phasecentre` (a Direction), and are calculated for each antenna once per unique time.
+# As for mconvert!(), `threads` partitions the unique times across native threads.
+function uvws!(
+    out::AbstractMatrix{Float64}, positions::AbstractMatrix, ant1::AbstractVector{<:Integer},
+    ant2::AbstractVector{<:Integer}, times::AbstractVector{<:Real}, phasecentre::AbstractMeasure;
+    threads::Int=1
+)
+    nrow = length(times)
+    if size(positions, 1) != 3 || size(out) != (3, nrow) || length(ant1) != nrow || length(ant2) != nrow
+        throw(DimensionMismatch(
+            "Expected 3 x nant positions, and $(nrow) antenna pairs with 3 x $(nrow) output"
+        ))
+    end
+
+    nant = size(positions, 2)
+    if !all(a -> 1 <= a <= nant, ant1) || !all(a -> 1 <= a <= nant, ant2)
+        throw(ArgumentError("Antenna indices must be in range 1:$(nant)"))
+    end
+
+    positions = collect(Float64, positions)
+    ant1 = collect(Int64, ant1) .- 1
+    ant2 = collect(Int64, ant2) .- 1
+    times = collect(Float64, times)
+    outarr = out isa Matrix{Float64} ? out : Matrix{Float64}(undef, size(out))
+
+    GC.@preserve outarr positions ant1 ant2 times begin
+        LibCasacore.calcuvws(
+            pointer(outarr), pointer(positions), nant, pointer(ant1), pointer(ant2),
+            pointer(times), nrow, phasecentre.m, threads
+        )
+    end
+
+    outarr === out || copyto!(out, outarr)
+    return out
+end
+
+function uvws(positions::AbstractMatrix, ant1, ant2, times, phasecentre::AbstractMeasure; kwargs...)
+    out = Matrix{Float64}(undef, 3, length(times))
+    return uvws!(out, positions, ant1, ant2, times, phasecentre; kwargs...)
+end
+
+end
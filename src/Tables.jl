@@ -1,6 +1,6 @@
 module Tables
 
-export taql
+export taql, taqlrows, taqlcalc!
 
 using ..LibCasacore
 using CEnum
@@ -14,11 +14,217 @@ using CEnum
     Delete
 end
 
+# Storage manager specifications, for binding new columns to a storage manager with specific
+# parameters. Where `name` is nothing, the storage manager (or hypercolumn) is named after the column.
+abstract type StorageManager end
+
+struct StandardStMan <: StorageManager
+    name::Union{Nothing, Symbol}
+    bucketsize::Int
+    cachesize::Int
+end
+
+"""
+    StandardStMan(; name=nothing, bucketsize=0, cachesize=1)
+
+Standard storage manager, with `bucketsize` in bytes (or `0` to derive it from the row size) and
+`cachesize` in buckets.
+"""
+StandardStMan(; name=nothing, bucketsize=0, cachesize=1) = StandardStMan(name, bucketsize, cachesize)
+
+struct IncrementalStMan <: StorageManager
+    name::Union{Nothing, Symbol}
+    bucketsize::Int
+    cachesize::Int
+end
+
+"""
+    IncrementalStMan(; name=nothing, bucketsize=0, cachesize=1)
+
+Incremental storage manager, suited to columns whose values change slowly between rows.
+"""
+IncrementalStMan(; name=nothing, bucketsize=0, cachesize=1) = IncrementalStMan(name, bucketsize, cachesize)
+
+# The tiled storage managers store array columns as hypercubes split into tiles. The tile shape has
+# one dimension more than the cells: the last dimension gives the number of rows per tile.
+const TILED_DOCS = """
+`tileshape` gives the cell axes followed by the number of rows per tile (e.g. `(4, 32, 128)` for
+4 correlations × 32 channels × 128 rows), and should be chosen to match the expected access
+pattern. `name` is the storage manager (and hypercolumn) name, which must be unique within the
+table; by default it is the column name. `maxcachesize` limits the tile cache (in MiB), where `0` is unlimited.
+"""
+
+struct TiledColumnStMan <: StorageManager
+    name::Union{Nothing, Symbol}
+    tileshape::Tuple{Vararg{Int}}
+    maxcachesize::Int
+end
+
+"""
+    TiledColumnStMan(tileshape; name=nothing, maxcachesize=0)
+
+Tiled storage manager for fixed shape array columns, stored as a single hypercube.
+
+$(TILED_DOCS)
+"""
+function TiledColumnStMan(tileshape; name=nothing, maxcachesize=0)
+    return TiledColumnStMan(name, Tuple(tileshape), maxcachesize)
+end
+
+struct TiledShapeStMan <: StorageManager
+    name::Union{Nothing, Symbol}
+    tileshape::Tuple{Vararg{Int}}
+    maxcachesize::Int
+end
+
+"""
+    TiledShapeStMan(tileshape; name=nothing, maxcachesize=0)
+
+Tiled storage manager for variably shaped array columns, with a hypercube for each unique cell
+shape.
+
+$(TILED_DOCS)
+"""
+function TiledShapeStMan(tileshape; name=nothing, maxcachesize=0)
+    return TiledShapeStMan(name, Tuple(tileshape), maxcachesize)
+end
+
+struct TiledCellStMan <: StorageManager
+    name::Union{Nothing, Symbol}
+    tileshape::Tuple{Vararg{Int}}
+    maxcachesize::Int
+end
+
+"""
+    TiledCellStMan(tileshape; name=nothing, maxcachesize=0)
+
+Tiled storage manager for variably shaped array columns, with a hypercube for each cell.
+
+$(TILED_DOCS)
+"""
+function TiledCellStMan(tileshape; name=nothing, maxcachesize=0)
+    return TiledCellStMan(name, Tuple(tileshape), maxcachesize)
+end
+
+_stmanname(stman::StorageManager, column::Symbol) = something(stman.name, column)
+
+function _datamanager(stman::StandardStMan, column::Symbol)
+    return LibCasacore.StandardStMan(LibCasacore.String(_stmanname(stman, column)), stman.bucketsize, stman.cachesize)
+end
+
+function _datamanager(stman::IncrementalStMan, column::Symbol)
+    return LibCasacore.IncrementalStMan(
+        LibCasacore.String(_stmanname(stman, column)), stman.bucketsize, true, stman.cachesize
+    )
+end
+
+function _datamanager(stman::TiledColumnStMan, column::Symbol)
+    return LibCasacore.TiledColumnStMan(
+        LibCasacore.String(_stmanname(stman, column)), LibCasacore.IPosition(stman.tileshape), stman.maxcachesize
+    )
+end
+
+function _datamanager(stman::TiledShapeStMan, column::Symbol)
+    return LibCasacore.TiledShapeStMan(
+        LibCasacore.String(_stmanname(stman, column)), LibCasacore.IPosition(stman.tileshape), stman.maxcachesize
+    )
+end
+
+function _datamanager(stman::TiledCellStMan, column::Symbol)
+    return LibCasacore.TiledCellStMan(
+        LibCasacore.String(_stmanname(stman, column)), LibCasacore.IPosition(stman.tileshape), stman.maxcachesize
+    )
+end
+
+# Virtual column engines that store a ComplexF32 (or Float32) array column as scaled 16 bit
+# integers in a separate column named <column>_COMPRESSED. Unless a fixed scale is given, the scale
+# and offset are chosen per row, and stored in the scalar columns <column>_SCALE and <column>_OFFSET.
+abstract type CompressionEngine <: StorageManager end
+
+const COMPRESSION_DOCS = """
+If `scale` is `nothing`, the scale and offset are chosen for each row to fit its values.
+Otherwise, values are stored as `round((value - offset) / scale)`. The stored column is bound to
+the `storage` manager.
+"""
+
+struct CompressComplex <: CompressionEngine
+    scale::Union{Nothing, Float32}
+    offset::Float32
+    storage::Union{Symbol, StorageManager}
+end
+
+"""
+    CompressComplex(; scale=nothing, offset=0, storage=:StandardStMan)
+
+Compress a `ComplexF32` array column, storing the real and imaginary parts as 16 bit integers.
+
+$(COMPRESSION_DOCS)
+"""
+function CompressComplex(; scale=nothing, offset=0, storage=:StandardStMan)
+    return CompressComplex(scale, offset, storage)
+end
+
+struct CompressComplexSD <: CompressionEngine
+    scale::Union{Nothing, Float32}
+    offset::Float32
+    storage::Union{Symbol, StorageManager}
+end
+
+"""
+    CompressComplexSD(; scale=nothing, offset=0, storage=:StandardStMan)
+
+Compress a `ComplexF32` array column as for `CompressComplex`, but using more bits for the real
+part where the imaginary part is zero, such as for single dish data or autocorrelations.
+
+$(COMPRESSION_DOCS)
+"""
+function CompressComplexSD(; scale=nothing, offset=0, storage=:StandardStMan)
+    return CompressComplexSD(scale, offset, storage)
+end
+
+struct CompressFloat <: CompressionEngine
+    scale::Union{Nothing, Float32}
+    offset::Float32
+    storage::Union{Symbol, StorageManager}
+end
+
+"""
+    CompressFloat(; scale=nothing, offset=0, storage=:StandardStMan)
+
+Compress a `Float32` array column, storing its values as 16 bit integers.
+
+$(COMPRESSION_DOCS)
+"""
+function CompressFloat(; scale=nothing, offset=0, storage=:StandardStMan)
+    return CompressFloat(scale, offset, storage)
+end
+
+_compressedtype(::Union{CompressComplex, CompressComplexSD}) = ComplexF32
+_compressedtype(::CompressFloat) = Float32
+
+_storedtype(::Union{CompressComplex, CompressComplexSD}) = Int32
+_storedtype(::CompressFloat) = Int16
+
+_compressedcolumns(column::Symbol) = (Symbol(column, :_COMPRESSED), Symbol(column, :_SCALE), Symbol(column, :_OFFSET))
+
+function _engineargs(engine::CompressionEngine, column::Symbol)
+    stored, scale, offset = LibCasacore.String.(_compressedcolumns(column))
+    if engine.scale === nothing
+        return (LibCasacore.String(column), stored, scale, offset, true)
+    else
+        return (LibCasacore.String(column), stored, engine.scale, engine.offset)
+    end
+end
+
+_datamanager(engine::CompressComplex, column::Symbol) = LibCasacore.CompressComplex(_engineargs(engine, column)...)
+_datamanager(engine::CompressComplexSD, column::Symbol) = LibCasacore.CompressComplexSD(_engineargs(engine, column)...)
+_datamanager(engine::CompressFloat, column::Symbol) = LibCasacore.CompressFloat(_engineargs(engine, column)...)
+
 abstract type ColumnDesc{T} end
 
 struct ScalarColumnDesc{T} <: ColumnDesc{T}
     comment::String
-    datamanager::Symbol
+    datamanager::Union{Symbol, StorageManager}
     datagroup::Symbol
 end
 
@@ -39,7 +245,7 @@ end
 struct ArrayColumnDesc{T, N} <: ColumnDesc{T}
     shape::Union{Nothing, NTuple{N, Int}}
     comment::String
-    datamanager::Symbol
+    datamanager::Union{Symbol, StorageManager}
     datagroup::Symbol
 end
 
@@ -160,8 +366,36 @@ end
 
 const IndexTypes = Union{Int, Colon, OrdinalRange}
 
+# Rows may additionally be selected by arbitrary row numbers or by a mask
+const RowIndexTypes = Union{IndexTypes, AbstractVector{Int}, AbstractVector{Bool}}
+const RowVectorTypes = Union{Colon, AbstractVector{Int}, AbstractVector{Bool}}
+
+# Select rows (as 1-based indices) either as a range, which is read with a single Slicer, or as
+# arbitrary row numbers, which are read as RefRows. RefRows collapses runs of adjacent rows, so
+# that storage managers can coalesce their reads.
+_rowselection(row::Int) = LibCasacore.Slicer(row - 1)
+_rowselection(rows::AbstractRange{Int}) = LibCasacore.Slicer(rows .- 1)
+
+function _rowselection(rows::AbstractVector{Int})
+    rownrs = collect(Int64, rows .- 1)
+    return GC.@preserve rownrs LibCasacore.RefRows(pointer(rownrs), length(rownrs))
+end
+
+_getrows(columnref, rows::LibCasacore.Slicer, args...) = LibCasacore.getColumnRange(columnref, rows, args...)
+_getrows(columnref, rows::LibCasacore.RefRows, args...) = LibCasacore.getColumnCells(columnref, rows, args...)
+
+_putrows!(columnref, rows::LibCasacore.Slicer, args...) = LibCasacore.putColumnRange(columnref, rows, args...)
+_putrows!(columnref, rows::LibCasacore.RefRows, args...) = LibCasacore.putColumnCells(columnref, rows, args...)
+
+# Cells may only be indexed by integers and ranges; arbitrary indices are supported along rows only
+function _checkcellindices(Icell)
+    if !all(i -> i isa Union{Int, AbstractRange}, Icell)
+        throw(ArgumentError("Cells can only be indexed by integers, ranges and ':'; arbitrary indices are only supported along rows."))
+    end
+end
+
 # Scalar or fixed shape multidim arrays
-@inline function checkbounds(x::Column{T, N}, I::Vararg{IndexTypes, M}) where {T, N, M}
+@inline function checkbounds(x::Column{T, N}, I::Vararg{RowIndexTypes, M}) where {T, N, M}
     if N != M
         throw(DimensionMismatch("Indexing into $(N)-dimensional Column with $(M) indices"))
     end
@@ -170,12 +404,12 @@ const IndexTypes = Union{Int, Colon, OrdinalRange}
 end
 
 # Row index on array of arrays
-@inline function checkbounds(x::Column{T, 1, <:LibCasacore.ArrayColumn}, i::IndexTypes) where T
+@inline function checkbounds(x::Column{T, 1, <:LibCasacore.ArrayColumn}, i::RowIndexTypes) where T
     Base.checkbounds_indices(Bool, axes(x), (i,)) || throw(BoundsError(x, i))
 end
 
 # Multidim index into array of arrays
-@inline function checkbounds(x::Column{T, 1, <:LibCasacore.ArrayColumn}, I::Vararg{IndexTypes, M}) where {T, M}
+@inline function checkbounds(x::Column{T, 1, <:LibCasacore.ArrayColumn}, I::Vararg{RowIndexTypes, M}) where {T, M}
     # Base.ndims() is not defined is N is unset.
     function ndims(::Type{P}) where {T, N, P <: Array{T, N}}
         return N
@@ -205,7 +439,7 @@ function Base.setindex!(c::Column, v)
 end
 
 # Scalar array indexing
-function Base.getindex(c::Column{T, 1, <:LibCasacore.ScalarColumn}, i::IndexTypes) where T
+function Base.getindex(c::Column{T, 1, <:LibCasacore.ScalarColumn}, i::RowIndexTypes) where T
     @boundscheck checkbounds(c, i)
     i = to_indices(c, (i,))
 
@@ -220,13 +454,14 @@ function Base.getindex(c::Column{T, 1, <:LibCasacore.ScalarColumn}, i::IndexType
     )
 
     # Write into dest
-    rowslicer = LibCasacore.Slicer(broadcast(.-, i, 1)...)
-    LibCasacore.getColumnRange(c.columnref, rowslicer, casacore_vector, false)
+    GC.@preserve dest begin
+        _getrows(c.columnref, _rowselection(i...), casacore_vector, false)
+    end
 
     return zerodim_as_scalar(dest)
 end
 
-function Base.setindex!(c::Column{T, 1, <:LibCasacore.ScalarColumn}, v, i::IndexTypes) where T
+function Base.setindex!(c::Column{T, 1, <:LibCasacore.ScalarColumn}, v, i::RowIndexTypes) where T
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
 
@@ -239,8 +474,7 @@ function Base.setindex!(c::Column{T, 1, <:LibCasacore.ScalarColumn}, v, i::Index
             convert(Ptr{Cvoid}, pointer(varray)),
             LibCasacore.SHARE
         )
-        rowslicer = LibCasacore.Slicer(i .- 1)
-        LibCasacore.putColumnRange(c.columnref, rowslicer, vectorslice)
+        _putrows!(c.columnref, _rowselection(i), vectorslice)
     end
 
     return v
@@ -276,11 +510,54 @@ function Base.getindex(c::Column{T, 1, <:LibCasacore.ArrayColumn}, i::Int)::T wh
     return dest
 end
 
-function Base.getindex(c::Column{T, 1, <:LibCasacore.ArrayColumn}, i::Union{Colon, OrdinalRange})::Vector{T} where T <: Array
+function Base.getindex(c::Column{T, 1, <:LibCasacore.ArrayColumn}, i::RowVectorTypes)::Vector{T} where T <: Array
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
-    return map(i) do i
-        @inbounds c[i]
+    return map(cell -> convert(T, copy(cell)), _getcells(c, i))
+end
+
+"""
+    cellviews(c::Column{<:Array, 1}, i=:)
+
+Read the cells of rows `i` from a column of variably shaped arrays in a single bulk operation,
+returning a vector of (reshaped) views into one flat buffer holding all of their data.
+"""
+function cellviews(c::Column{T, 1, <:LibCasacore.ArrayColumn}, i::RowVectorTypes=:) where T <: Array
+    @boundscheck checkbounds(c, i)
+    i, = to_indices(c, (i,))
+    return _getcells(c, i)
+end
+
+# Bulk read of variably shaped cells: the shapes of all cells are fetched first, and then their
+# data is read natively into a single flat buffer.
+function _getcells(c::Column{T, 1, <:LibCasacore.ArrayColumn}, i::AbstractVector{Int}) where T <: Array
+    rows = collect(Int64, i .- 1)
+    n = length(rows)
+
+    ndims = Vector{Int64}(undef, n)
+    maxdim = GC.@preserve rows ndims LibCasacore.ndims!(c.columnref, pointer(rows), n, pointer(ndims))
+
+    shapes = Matrix{Int64}(undef, maxdim, n)
+    GC.@preserve rows shapes LibCasacore.shapes!(c.columnref, pointer(rows), n, pointer(shapes), maxdim)
+
+    offsets = zeros(Int, n + 1)
+    for j in 1:n
+        offsets[j + 1] = offsets[j] + (ndims[j] == 0 ? 0 : prod(@view shapes[1:ndims[j], j]))
+    end
+
+    data = Vector{eltype(T)}(undef, offsets[end])
+    GC.@preserve rows data begin
+        LibCasacore.getCells!(c.columnref, pointer(rows), n, convert(Ptr{Cvoid}, pointer(data)), length(data))
+    end
+
+    return map(1:n) do j
+        if ndims[j] == 0
+            # Undefined cells are zero length, with the dimension of T if it is set
+            shape = T == Array{eltype(T)} ? (0,) : ntuple(zero, Base.ndims(T))
+        else
+            shape = Tuple(@view shapes[1:ndims[j], j])
+        end
+        return reshape(view(data, offsets[j] + 1:offsets[j + 1]), shape)
     end
 end
 
@@ -306,17 +583,53 @@ function Base.setindex!(c::Column{T, 1, <:LibCasacore.ArrayColumn}, v, i::Int)::
     return v
 end
 
-function Base.setindex!(c::Column{<:Array, 1, <:LibCasacore.ArrayColumn}, v, i::Union{Colon, OrdinalRange})
+function Base.setindex!(c::Column{T, 1, <:LibCasacore.ArrayColumn}, v, i::RowVectorTypes) where T <: Array
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
-    broadcast(i, v) do idx, val
-        @inbounds c[idx] = val
+
+    # Broadcast a single cell across all rows
+    vals = collect(v)
+    if length(vals) == 1
+        vals = fill(only(vals), length(i))
+    end
+    Base.setindex_shape_check(vals, length(i))
+
+    # Check dimensionality of values matches column
+    celldims = LibCasacore.ndimColumn(c.columnref)
+    for val in vals
+        if celldims != 0 && Base.ndims(val) != celldims
+            throw(DimensionMismatch("Expected value with $(celldims) dimensions, got $(Base.ndims(val))"))
+        end
+    end
+
+    # Pack all cells into a single flat buffer, and write natively in one call
+    varrays = map(val -> collect(eltype(T), val), vals)
+    rows = collect(Int64, i .- 1)
+    ndims = collect(Int64, Base.ndims.(varrays))
+    maxdim = maximum(ndims; init=0)
+    shapes = zeros(Int64, maxdim, length(varrays))
+    for (j, varray) in enumerate(varrays)
+        shapes[1:ndims[j], j] .= size(varray)
+    end
+    data = Vector{eltype(T)}(undef, sum(length, varrays; init=0))
+    offset = 1
+    for varray in varrays
+        copyto!(data, offset, varray, 1, length(varray))
+        offset += length(varray)
     end
+
+    GC.@preserve rows ndims shapes data begin
+        LibCasacore.putCells!(
+            c.columnref, pointer(rows), length(rows), pointer(ndims), pointer(shapes), maxdim,
+            convert(Ptr{Cvoid}, pointer(data))
+        )
+    end
+
     return v
 end
 
 # Multidimensional array indexing
-function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::IndexTypes, I::IndexTypes...) where {T, N}
+function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::RowIndexTypes, I::RowIndexTypes...) where {T, N}
     I = (i, I...)
     @boundscheck checkbounds(c, I...)
 
@@ -334,6 +647,7 @@ function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::IndexTypes
     else
         I = to_indices(c, I)
     end
+    _checkcellindices(I[1:(end - 1)])
 
     # Create destination
     shape = length.(Base.index_shape(I...))  # singleton dimensions are collapsed
@@ -346,17 +660,18 @@ function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::IndexTypes
     )
 
     # 0- to 1-based indexing
-    I = broadcast(.-, I, 1)
-    rowslicer = LibCasacore.Slicer(I[end])
-    cellslicer = LibCasacore.Slicer(I[1:(end - 1)]...)
+    rows = _rowselection(I[end])
+    cellslicer = LibCasacore.Slicer(broadcast(.-, I[1:(end - 1)], 1)...)
 
     # Copy column slice into dest
-    LibCasacore.getColumnRange(c.columnref, rowslicer, cellslicer, casacore_array, false)
+    GC.@preserve dest begin
+        _getrows(c.columnref, rows, cellslicer, casacore_array, false)
+    end
 
     return zerodim_as_scalar(dest)
 end
 
-function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::IndexTypes, I::IndexTypes...) where {T, N}
+function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::RowIndexTypes, I::RowIndexTypes...) where {T, N}
     I = (i, I...)
     @boundscheck checkbounds(c, I...)
 
@@ -374,14 +689,14 @@ function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::IndexT
     else
         I = to_indices(c, I)
     end
+    _checkcellindices(I[1:(end - 1)])
 
     varray = collect(eltype(T), v)
     Base.setindex_shape_check(varray, length.(I)...)
 
     # 1- to 0-based indexing
-    I = broadcast(.-, I, 1)
-    rowslicer = LibCasacore.Slicer(I[end])
-    cellslicer = LibCasacore.Slicer(I[1:(end - 1)]...)
+    rows = _rowselection(I[end])
+    cellslicer = LibCasacore.Slicer(broadcast(.-, I[1:(end - 1)], 1)...)
 
     GC.@preserve varray begin
         arrayslice = LibCasacore.Array{LibCasacore.getcxxtype(eltype(T))}(
@@ -389,40 +704,62 @@ function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::IndexT
             convert(Ptr{Cvoid}, pointer(varray)),
             LibCasacore.SHARE
         )
-        LibCasacore.putColumnRange(c.columnref, rowslicer, cellslicer, arrayslice)
+        _putrows!(c.columnref, rows, cellslicer, arrayslice)
     end
 
     return v
 end
 
+# Read a full scalar or fixed shape column directly into a caller provided (contiguous) buffer
+function Base.copyto!(dest::StridedArray{T}, c::Column{T, N}) where {T <: Number, N}
+    if size(dest) != size(c)
+        throw(DimensionMismatch("Cannot copy Column of size $(size(c)) into destination of size $(size(dest))"))
+    end
+    if strides(dest) != Base.size_to_strides(1, size(dest)...)
+        throw(ArgumentError("Destination of copyto!() must be contiguous in memory"))
+    end
+    length(dest) == 0 && return dest
+
+    # 0-based indices spanning the full column
+    I = map(n -> 0:(n - 1), size(dest))
+    rowslicer = LibCasacore.Slicer(I[end])
+
+    GC.@preserve dest begin
+        if N == 1
+            casacore_vector = LibCasacore.Vector{LibCasacore.getcxxtype(T)}(
+                LibCasacore.IPosition(size(dest)), convert(Ptr{Cvoid}, pointer(dest)), LibCasacore.SHARE
+            )
+            LibCasacore.getColumnRange(c.columnref, rowslicer, casacore_vector, false)
+        else
+            casacore_array = LibCasacore.Array{LibCasacore.getcxxtype(T)}(
+                LibCasacore.IPosition(size(dest)), convert(Ptr{Cvoid}, pointer(dest)), LibCasacore.SHARE
+            )
+            cellslicer = LibCasacore.Slicer(I[1:(end - 1)]...)
+            LibCasacore.getColumnRange(c.columnref, rowslicer, cellslicer, casacore_array, false)
+        end
+    end
+
+    return dest
+end
+
 # Setindex and getindex! for String type
 # This is special since it is not a primitive type and does not allow for simple bit coversions.
+# Bulk transfers use LibCasacore.tostrings() and fromstrings!(), which pack all strings into a
+# single byte buffer rather than boxing each element.
 
 function Base.getindex(c::Column{String, 1, <:LibCasacore.ScalarColumn}, i::Int)
     @boundscheck checkbounds(c, i)
     return String(LibCasacore.getindex(c.columnref, i - 1))
 end
 
-function Base.getindex(c::Column{String, 1, <:LibCasacore.ScalarColumn}, i::Union{Colon, OrdinalRange})
+function Base.getindex(c::Column{String, 1, <:LibCasacore.ScalarColumn}, i::RowVectorTypes)
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
-    return map(i) do idx
-        @inbounds c[idx]
-    end
 
     # Fetch data
-    rowslicer = LibCasacore.Slicer(broadcast(.-, i, 1)...)
-    casacore_vector = LibCasacore.getColumnRange(c.columnref, rowslicer)
+    casacore_vector = _getrows(c.columnref, _rowselection(i))
 
-    # Copy into dest and fix type and size
-    dest = Any[]
-    LibCasacore.copy!(dest, casacore_vector)
-
-    # Correctly size output array and convert to Julia String
-    shape = length.(Base.index_shape(i...))
-    dest = map(String, reshape(dest, shape))
-
-    return dest
+    return LibCasacore.tostrings(casacore_vector)
 end
 
 function Base.setindex!(c::Column{String, 1, <:LibCasacore.ScalarColumn}, v, i::Int)
@@ -431,21 +768,19 @@ function Base.setindex!(c::Column{String, 1, <:LibCasacore.ScalarColumn}, v, i::
     return nothing
 end
 
-function Base.setindex!(c::Column{String, 1, <:LibCasacore.ScalarColumn}, v, i::Union{Colon, OrdinalRange})
+function Base.setindex!(c::Column{String, 1, <:LibCasacore.ScalarColumn}, v, i::RowVectorTypes)
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
 
-    varray = Vector{Any}(undef, length(v))
-    map!(LibCasacore.String ∘ string, varray, v)
+    varray = Vector{String}(undef, length(v))
+    map!(string, varray, v)
     Base.setindex_shape_check(varray, length(i))
 
     casacore_vector = LibCasacore.Vector{LibCasacore.String}(
         LibCasacore.IPosition(size(i))
     )
-    LibCasacore.copy!(casacore_vector, varray)
-
-    rowslicer = LibCasacore.Slicer(i .- 1)
-    LibCasacore.putColumnRange(c.columnref, rowslicer, casacore_vector)
+    LibCasacore.fromstrings!(casacore_vector, varray)
+    _putrows!(c.columnref, _rowselection(i), casacore_vector)
 
     return nothing
 end
@@ -465,14 +800,11 @@ function Base.getindex(c::Column{T, 1, <:LibCasacore.ArrayColumn}, i::Int) where
         end
     end
 
-    dest = Any[]  # Type Any is required for CxxWrap ArrayRef
     casacore_array = LibCasacore.get(c.columnref, i - 1)
-    LibCasacore.copy!(dest, casacore_array)
-
-    return map(String, reshape(dest, size(casacore_array)))
+    return LibCasacore.tostrings(casacore_array)
 end
 
-function Base.getindex(c::Column{<:Array{String}, 1, <:LibCasacore.ArrayColumn}, i::Union{Colon, OrdinalRange})
+function Base.getindex(c::Column{<:Array{String}, 1, <:LibCasacore.ArrayColumn}, i::RowVectorTypes)
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
 
@@ -491,17 +823,17 @@ function Base.setindex!(c::Column{<:Array{String}, 1, <:LibCasacore.ArrayColumn}
         throw(DimensionMismatch("Expected value with $(celldims) dimensions, got $(ndims(v))"))
     end
 
-    varray = Vector{Any}(undef, length(v))  # Type Any is required for CxxWrap ArrayRef
-    map!(LibCasacore.String ∘ string, varray, v)
+    varray = Vector{String}(undef, length(v))
+    map!(string, varray, v)
 
     casacore_array = LibCasacore.Array{LibCasacore.String}(LibCasacore.IPosition(size(v)))
-    LibCasacore.copy!(casacore_array, varray)
+    LibCasacore.fromstrings!(casacore_array, varray)
     LibCasacore.put(c.columnref, i - 1, casacore_array)
 
     return nothing
 end
 
-function Base.setindex!(c::Column{<:Array{String}, 1, <:LibCasacore.ArrayColumn}, v, i::Union{Colon, OrdinalRange})
+function Base.setindex!(c::Column{<:Array{String}, 1, <:LibCasacore.ArrayColumn}, v, i::RowVectorTypes)
     @boundscheck checkbounds(c, i)
     i, = to_indices(c, (i,))
 
@@ -511,7 +843,7 @@ function Base.setindex!(c::Column{<:Array{String}, 1, <:LibCasacore.ArrayColumn}
     return nothing
 end
 
-function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::IndexTypes, I::IndexTypes...) where {T <: Union{String, Array{String}}, N}
+function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::RowIndexTypes, I::RowIndexTypes...) where {T <: Union{String, Array{String}}, N}
     I = (i, I...)
     @boundscheck checkbounds(c, I...)
 
@@ -529,22 +861,18 @@ function Base.getindex(c::Column{T, N, <:LibCasacore.ArrayColumn}, i::IndexTypes
     else
         I = to_indices(c, I)
     end
+    _checkcellindices(I[1:(end - 1)])
 
     # 0- to 1-based indexing
-    I = broadcast(.-, I, 1)
-    rowslicer = LibCasacore.Slicer(I[end])
-    cellslicer = LibCasacore.Slicer(I[1:(end - 1)]...)
+    rows = _rowselection(I[end])
+    cellslicer = LibCasacore.Slicer(broadcast(.-, I[1:(end - 1)], 1)...)
 
     # Retrieve column slice
-    casacore_array = LibCasacore.getColumnRange(c.columnref, rowslicer, cellslicer)
+    casacore_array = _getrows(c.columnref, rows, cellslicer)
 
-    # Copy out data from array
-    dest = Any[]
-    LibCasacore.copy!(dest, casacore_array)
-
-    # Transform dest to typed and correctly sized array
-    shape = length.(Base.index_shape(I...))  # singleton dimensions are collapsed
-    dest = map(String, reshape(dest, shape))
+    # Copy out data from array, and correctly size (singleton dimensions are collapsed)
+    shape = length.(Base.index_shape(I...))
+    dest = reshape(LibCasacore.tostrings(casacore_array), shape)
 
     return zerodim_as_scalar(dest)
 end
@@ -553,7 +881,7 @@ function Base.setindex!(c::Column{<:Union{String, Array{String}}, N, <:LibCasaco
     c[i, I...] = [string(v)]
 end
 
-function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::IndexTypes, I::IndexTypes...) where {T <: Union{String, Array{String}}, N}
+function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::RowIndexTypes, I::RowIndexTypes...) where {T <: Union{String, Array{String}}, N}
     I = (i, I...)
     @boundscheck checkbounds(c, I...)
 
@@ -571,39 +899,116 @@ function Base.setindex!(c::Column{T, N, <:LibCasacore.ArrayColumn}, v, i::IndexT
     else
         I = to_indices(c, I)
     end
+    _checkcellindices(I[1:(end - 1)])
 
-    varray = Vector{Any}(undef, length(v))
-    map!(LibCasacore.String ∘ string, varray, v)
+    varray = Vector{String}(undef, length(v))
+    map!(string, varray, v)
     Base.setindex_shape_check(varray, length.(I)...)
 
     # 1- to 0-based indexing
-    I = broadcast(.-, I, 1)
-    rowslicer = LibCasacore.Slicer(I[end])
-    cellslicer = LibCasacore.Slicer(I[1:(end - 1)]...)
+    rows = _rowselection(I[end])
+    cellslicer = LibCasacore.Slicer(broadcast(.-, I[1:(end - 1)], 1)...)
 
     # Copy contents of varray into caacore array and then into the column
     casacore_array = LibCasacore.Array{LibCasacore.String}(LibCasacore.IPosition(length.(I)))
-    LibCasacore.copy!(casacore_array, varray)
-    LibCasacore.putColumnRange(c.columnref, rowslicer, cellslicer, casacore_array)
+    LibCasacore.fromstrings!(casacore_array, varray)
+    _putrows!(c.columnref, rows, cellslicer, casacore_array)
 
     return nothing
 end
 
 struct Table
     tableref::LibCasacore.TableAllocated
+    # Column accessors and subtables are cached as they are opened, since constructing them
+    # requires reading the table description or keywords. Both caches are guarded by _lock. These
+    # fields are prefixed so as not to hide subtables of the same name, and are accessed with
+    # getfield() since getproperty() is overloaded.
+    _columns::Dict{Symbol, Column}
+    _subtables::Dict{Symbol, Table}
+    _lock::ReentrantLock
 end
 
-function Table(path::String, tableoption::TableOptions=Old)
+Table(tableref) = Table(tableref, Dict{Symbol, Column}(), Dict{Symbol, Table}(), ReentrantLock())
+
+const TSM_IO_MODES = (
+    cache = LibCasacore.TSMCache,
+    buffer = LibCasacore.TSMBuffer,
+    mmap = LibCasacore.TSMMMap,
+    default = LibCasacore.TSMDefault,
+)
+
+const LOCK_MODES = (
+    auto = LibCasacore.AutoLocking,
+    autonoread = LibCasacore.AutoNoReadLocking,
+    user = LibCasacore.UserLocking,
+    usernoread = LibCasacore.UserNoReadLocking,
+    permanent = LibCasacore.PermanentLocking,
+    permanentwait = LibCasacore.PermanentLockingWait,
+    nolock = LibCasacore.NoLocking,
+)
+
+"""
+    Table(path::String, tableoption::TableOptions=Old; io=nothing, buffersize=0, lock=nothing, inspectioninterval=5.0)
+
+Open or create the table at `path`.
+
+`io` selects how the tiled storage managers access their files: `:mmap` memory maps them (sharing
+the OS page cache between processes reading the same table), `:buffer` uses buffered I/O with a
+buffer of `buffersize` bytes (or casacore's default if `0`), and `:cache` uses casacore's own
+bucket caches. `:default` memory maps large files and caches smaller ones. If `io` is `nothing`,
+this is configured by the `table.tsm.option` casarc variable.
+
+`lock` sets the locking of an existing table:
+
+  * `:auto` acquires and releases locks as needed, and releases them when another process
+    requests them, which is checked every `inspectioninterval` seconds.
+  * `:user` leaves locking to the caller, using `lock!()` and `unlock!()`.
+  * `:permanent` holds a lock for as long as the table is open, failing if it cannot be acquired
+    (or waiting, with `:permanentwait`).
+  * `:nolock` skips locking altogether, which is only safe when no other process writes the table.
+
+`:autonoread` and `:usernoread` do not acquire read locks. If `lock` is `nothing`, casacore's
+default (auto) locking applies.
+"""
+function Table(
+    path::String, tableoption::TableOptions=Old;
+    io::Union{Nothing, Symbol}=nothing, buffersize::Int=0,
+    lock::Union{Nothing, Symbol}=nothing, inspectioninterval::Real=5.0
+)
     path = LibCasacore.String(path)
 
+    if lock !== nothing && !haskey(LOCK_MODES, lock)
+        throw(ArgumentError("Unknown lock mode $(lock); expected one of $(keys(LOCK_MODES))"))
+    end
+
+    if io === nothing
+        tsmoption = LibCasacore.TSMOption(LibCasacore.TSMAipsrc, 0, -1)
+    elseif haskey(TSM_IO_MODES, io)
+        if buffersize < 0
+            throw(ArgumentError("Buffer size must be non-negative"))
+        end
+        tsmoption = LibCasacore.TSMOption(TSM_IO_MODES[io], buffersize, -1)
+    else
+        throw(ArgumentError("Unknown io mode $(io); expected one of $(keys(TSM_IO_MODES))"))
+    end
+
     if tableoption ∈ (Old, Update)
         # Open existing table
-        tableref = LibCasacore.Table(path, Int(tableoption))
+        if lock === nothing
+            tableref = LibCasacore.Table(path, Int(tableoption), tsmoption)
+        else
+            tablelock = LibCasacore.TableLock(LOCK_MODES[lock], inspectioninterval, 0)
+            tableref = LibCasacore.Table(path, tablelock, Int(tableoption), tsmoption)
+        end
     elseif tableoption ∈ (
         New, NewNoReplace, Update, Scratch
     )
+        if lock !== nothing
+            throw(ArgumentError("Locking can only be set when opening an existing table"))
+        end
+
         # Create new table, possibly replacing old one
-        tableref = LibCasacore.Table(LibCasacore.Plain)
+        tableref = LibCasacore.Table(LibCasacore.Plain, tsmoption)
         LibCasacore.rename(tableref, path, Int(tableoption))
     else
         throw(ArugmentError("Invalid TableOption argument"))
@@ -612,6 +1017,34 @@ function Table(path::String, tableoption::TableOptions=Old)
     return Table(tableref)
 end
 
+"""
+    lock!(x::Table; write=true, attempts=0)
+
+Acquire a write (or read) lock on table `x`, returning whether it succeeded. `attempts` is the
+number of times to try, once per second, where `0` waits until the lock is acquired. This is
+required for tables opened with `lock=:user`.
+"""
+function lock!(x::Table; write::Bool=true, attempts::Int=0)
+    return Bool(LibCasacore.lock(x.tableref, write ? LibCasacore.WriteLock : LibCasacore.ReadLock, attempts))
+end
+
+"""
+    unlock!(x::Table)
+
+Release the lock on table `x`, first flushing any changes to disk.
+"""
+function unlock!(x::Table)
+    LibCasacore.unlock(x.tableref)
+    return x
+end
+
+"""
+    haslock(x::Table; write=true)
+
+Return whether a write (or read) lock is held on table `x`.
+"""
+haslock(x::Table; write::Bool=true) = Bool(LibCasacore.hasLock(x.tableref, write ? LibCasacore.WriteLock : LibCasacore.ReadLock))
+
 # Constructor used in creating subtables
 function Table()
     return Table(LibCasacore.Table(LibCasacore.Plain))
@@ -670,28 +1103,63 @@ function Base.deleteat!(x::Table, inds)
 end
 
 function Base.getindex(x::Table, name::Symbol)
-    if name in keys(x)
-        return Column(x.tableref, LibCasacore.String(name))
+    return lock(getfield(x, :_lock)) do
+        get!(getfield(x, :_columns), name) do
+            if name in keys(x)
+                return Column(x.tableref, LibCasacore.String(name))
+            end
+            throw(KeyError(name))
+        end
+    end
+end
+
+_stmantype(datamanager::Symbol) = datamanager
+_stmantype(datamanager::StorageManager) = nameof(typeof(datamanager))
+
+# Compressed columns are backed by a stored integer column, and unless a fixed scale is given,
+# scalar columns holding the scale and offset of each row. These must exist before the engine.
+function _addstoredcolumns!(x::Table, v::ArrayColumnDesc{T, N}, name::Symbol) where {T, N}
+    engine = v.datamanager
+    if T != _compressedtype(engine)
+        throw(ArgumentError("$(nameof(typeof(engine))) compresses columns of type $(_compressedtype(engine)), not $(T)"))
+    end
+
+    stored, scale, offset = _compressedcolumns(name)
+    x[stored] = ArrayColumnDesc{_storedtype(engine), N}(v.shape; datamanager=engine.storage)
+    if engine.scale === nothing
+        x[scale] = ScalarColumnDesc{Float32}()
+        x[offset] = ScalarColumnDesc{Float32}()
+    end
+end
+
+# Add a column, binding it to a new storage manager if one has been specified. Otherwise, the
+# column is bound to the storage manager named by its description.
+function _addcolumn!(x::Table, columndesc::LibCasacore.ColumnDesc, datamanager, name::Symbol)
+    lock(getfield(x, :_lock)) do
+        empty!(getfield(x, :_columns))
+        if datamanager isa StorageManager
+            LibCasacore.addColumn(x.tableref, columndesc, _datamanager(datamanager, name), true)
+        else
+            LibCasacore.addColumn(x.tableref, columndesc, true)
+        end
     end
-    throw(KeyError(name))
 end
 
 function Base.setindex!(x::Table, v::ScalarColumnDesc{T}, name::Symbol) where {T}
+    if v.datamanager isa CompressionEngine
+        throw(ArgumentError("Only array columns can be compressed"))
+    end
     if name in keys(x)
         delete!(x, name)
     end
-    LibCasacore.addColumn(
-        x.tableref,
-        LibCasacore.ColumnDesc(
-            LibCasacore.ScalarColumnDesc{LibCasacore.getcxxtype(T)}(
-                LibCasacore.String(name),
-                LibCasacore.String(v.comment),
-                LibCasacore.String(v.datamanager),
-                LibCasacore.String(v.datagroup),
-            )
-        ),
-        true
+    columndesc = LibCasacore.ScalarColumnDesc{LibCasacore.getcxxtype(T)}(
+        LibCasacore.String(name),
+        LibCasacore.String(v.comment),
+        LibCasacore.String(_stmantype(v.datamanager)),
+        LibCasacore.String(v.datagroup),
     )
+
+    _addcolumn!(x, LibCasacore.ColumnDesc(columndesc), v.datamanager, name)
     return v
 end
 
@@ -699,13 +1167,16 @@ function Base.setindex!(x::Table, v::ArrayColumnDesc{T, N}, name::Symbol) where
     if name in keys(x)
         delete!(x, name)
     end
+    if v.datamanager isa CompressionEngine
+        _addstoredcolumns!(x, v, name)
+    end
 
     if v.shape == nothing
         # Non-fixed shape, possibly non-fixed dimesions (if N = 0)
         columndesc = LibCasacore.ArrayColumnDesc{LibCasacore.getcxxtype(T)}(
             LibCasacore.String(name),
             LibCasacore.String(v.comment),
-            LibCasacore.String(v.datamanager),
+            LibCasacore.String(_stmantype(v.datamanager)),
             LibCasacore.String(v.datagroup),
             N
         )
@@ -714,15 +1185,13 @@ function Base.setindex!(x::Table, v::ArrayColumnDesc{T, N}, name::Symbol) where
         columndesc = LibCasacore.ArrayColumnDesc{LibCasacore.getcxxtype(T)}(
             LibCasacore.String(name),
             LibCasacore.String(v.comment),
-            LibCasacore.String(v.datamanager),
+            LibCasacore.String(_stmantype(v.datamanager)),
             LibCasacore.String(v.datagroup),
             LibCasacore.IPosition(v.shape),
         )
     end
 
-    LibCasacore.addColumn(
-        x.tableref, LibCasacore.ColumnDesc(columndesc), true
-    )
+    _addcolumn!(x, LibCasacore.ColumnDesc(columndesc), v.datamanager, name)
     return v
 end
 
@@ -793,15 +1262,67 @@ function Base.setindex!(x::Table, v::Vector{T}, name::Symbol) where {M, T <: Arr
 end
 
 function Base.delete!(x::Table, name::Symbol)
-    if name in keys(x)
-        LibCasacore.removeColumn(x.tableref, LibCasacore.String(name))
-        return
+    lock(getfield(x, :_lock)) do
+        if name in keys(x)
+            # Changes to the set of columns invalidate all cached columns
+            empty!(getfield(x, :_columns))
+            LibCasacore.removeColumn(x.tableref, LibCasacore.String(name))
+            return
+        end
+        if name in propertynames(x)
+            delete!(getfield(x, :_subtables), name)
+            LibCasacore.deleteSubTable(x.tableref, LibCasacore.String(name), true)
+            return
+        end
+        throw(KeyError(name))
     end
-    if name in propertynames(x)
-        LibCasacore.deleteSubTable(x.tableref, LibCasacore.String(name), true)
-        return
+end
+
+# Tile cache control for columns stored by a tiled storage manager. Settings apply to all columns
+# bound to the same storage manager, and last only as long as the table remains open.
+function _tiledaccessor(c::Column)
+    return LibCasacore.ROTiledStManAccessor(c.parent, LibCasacore.String(c.name), true)
+end
+
+"""
+    tileshape(c::Column)
+
+Return the tile shape used to store column `c`, which must be bound to a tiled storage manager. The
+last dimension is the number of rows per tile.
+"""
+tileshape(c::Column) = Tuple(LibCasacore.tileShape(_tiledaccessor(c), 0))
+
+"""
+    maxcachesize(c::Column)
+
+Return the maximum tile cache size (in MiB) of the tiled storage manager holding column `c`, where
+`0` is unlimited.
+"""
+maxcachesize(c::Column) = Int(LibCasacore.maximumCacheSize(_tiledaccessor(c)))
+
+"""
+    maxcachesize!(c::Column, size::Int)
+
+Limit the tile cache (in MiB) of the tiled storage manager holding column `c`, where `0` is
+unlimited. The cache should hold all tiles intersected by a typical read (e.g. a single channel
+across many rows), otherwise tiles are reread from disk.
+"""
+function maxcachesize!(c::Column, size::Int)
+    if size < 0
+        throw(ArgumentError("Cache size must be non-negative"))
     end
-    throw(KeyError(name))
+    LibCasacore.setMaximumCacheSize(_tiledaccessor(c), size)
+    return c
+end
+
+"""
+    clearcache!(c::Column)
+
+Flush and empty the tile caches of the tiled storage manager holding column `c`.
+"""
+function clearcache!(c::Column)
+    LibCasacore.clearCaches(_tiledaccessor(c))
+    return c
 end
 
 function Base.keys(x::Table)::Vector{Symbol}
@@ -828,13 +1349,21 @@ function Base.getproperty(x::Table, name::Symbol)
         return getfield(x, name)
     end
 
-    if name in propertynames(x)
-        recordid = LibCasacore.RecordFieldId(LibCasacore.String(name))
-        keywords = LibCasacore.keywordSet(x.tableref)
-        return Table(LibCasacore.asTable(keywords, recordid))
+    subtable = lock(getfield(x, :_lock)) do
+        subtables = getfield(x, :_subtables)
+        if haskey(subtables, name)
+            return subtables[name]
+        end
+
+        if name in propertynames(x)
+            recordid = LibCasacore.RecordFieldId(LibCasacore.String(name))
+            keywords = LibCasacore.keywordSet(x.tableref)
+            return subtables[name] = Table(LibCasacore.asTable(keywords, recordid))
+        end
+        return nothing
     end
 
-    return getfield(x, name)
+    return subtable === nothing ? getfield(x, name) : subtable
 end
 
 function Base.setproperty!(parent::Table, name::Symbol, sub::Table)
@@ -845,38 +1374,628 @@ function Base.setproperty!(parent::Table, name::Symbol, sub::Table)
         )
     )
 
-    # Columns, subtables (and others) share the same keyword namespace. We cannot add a
-    # subtable with existing keyword name.
-    idx = LibCasacore.fieldNumber(LibCasacore.keywordSet(parent.tableref), namestr)
-    if idx > 0
-        if LibCasacore.type(LibCasacore.keywordSet(parent.tableref), idx) != LibCasacore.TpTable
-            throw(ErrorException("Subtable name $(name) duplicates existing keyword"))
+    return lock(getfield(parent, :_lock)) do
+        # Columns, subtables (and others) share the same keyword namespace. We cannot add a
+        # subtable with existing keyword name.
+        idx = LibCasacore.fieldNumber(LibCasacore.keywordSet(parent.tableref), namestr)
+        if idx > 0
+            if LibCasacore.type(LibCasacore.keywordSet(parent.tableref), idx) != LibCasacore.TpTable
+                throw(ErrorException("Subtable name $(name) duplicates existing keyword"))
+            end
+
+            # Otherwise delete existing table
+            delete!(getfield(parent, :_subtables), name)
+            LibCasacore.deleteSubTable(parent.tableref, namestr, true)
+        end
+
+        # We do a copy, rather than a rename. This avoids mutating the sub, which is closer in
+        # in line with the semantics of setproperty!().
+        LibCasacore.deepCopy(sub.tableref, pathstr, Int(New))
+        subref = LibCasacore.Table(pathstr, Int(Old))
+
+        LibCasacore.defineTable(
+            LibCasacore.rwKeywordSet(parent.tableref), LibCasacore.RecordFieldId(namestr), subref
+        )
+
+        getfield(parent, :_subtables)[name] = Table(subref)  # Or return the original sub table?
+    end
+end
+
+flush(x::Table; fsync=true, recursive=true) = LibCasacore.flush(x.tableref, fsync, recursive)
+
+"""
+    instrument!(enabled::Bool=true)
+
+Enable (or disable) recording of the column I/O statistics returned by `iostats()`.
+Instrumentation is disabled by default, and costs little more than a flag check per native get or
+put call when disabled.
+"""
+function instrument!(enabled::Bool=true)
+    LibCasacore.setiostats!(enabled)
+    return nothing
+end
+
+"""
+    iostats(table::Table)
+
+Return the column I/O recorded for `table` whilst instrumentation is enabled (see
+`instrument!()`), as a Dict mapping column names to the number of native get and put calls, the
+bytes they transferred and their total wall time in seconds. Statistics are kept per table path,
+and so are shared by all open instances of a table.
+
+Reads and writes made through column indexing are recorded; those made by background readers and
+writers (e.g. `eachchunk()` and `WriteQueue`) are not.
+"""
+function iostats(table::Table)
+    out = Vector{Float64}(undef, 6)
+    return Dict(map(LibCasacore.iostatscolumns(table.tableref)) do column
+        GC.@preserve out LibCasacore.iostats!(table.tableref, column, pointer(out))
+        Symbol(column) => (
+            getcalls=Int(out[1]), getbytes=Int(out[2]), getseconds=out[3],
+            putcalls=Int(out[4]), putbytes=Int(out[5]), putseconds=out[6],
+        )
+    end)
+end
+
+"""
+    resetiostats!([table::Table])
+
+Reset the I/O statistics of `table`, or of all tables.
+"""
+function resetiostats!(table::Table)
+    LibCasacore.resetiostats!(table.tableref)
+    return nothing
+end
+
+function resetiostats!()
+    LibCasacore.resetiostats!()
+    return nothing
+end
+
+"""
+    eachchunk(table::Table, columns; rows=10_000)
+
+Iterate over `table` in chunks of (at most) `rows` rows, reading the scalar or fixed shape array
+`columns` into two sets of preallocated buffers. Whilst the caller processes one chunk, the next
+is read on a background thread into the other set of buffers.
+
+Each chunk is a NamedTuple of the chunk's `rows` (as a range) and views into the buffers for each
+column. The buffers are reused, so these views are only valid until the next iteration; copy them
+if they must be retained. The table must not otherwise be accessed during iteration.
+"""
+function eachchunk(table::Table, columns; rows::Int=10_000)
+    rows > 0 || throw(ArgumentError("Chunks must have a positive number of rows"))
+    return ChunkIterator(table, Tuple(Symbol.(columns)), rows)
+end
+
+mutable struct ChunkIterator{C, B}
+    const table::Table
+    const rows::Int
+    const buffers::NTuple{2, B}
+    const reader::LibCasacore.ChunkReaderAllocated
+
+    function ChunkIterator(table::Table, columns::NTuple{M, Symbol}, rows::Int) where M
+        reader = LibCasacore.ChunkReader()
+        buffers = ntuple(2) do _
+            map(columns) do name
+                _chunkbuffer(table[name], rows)
+            end
+        end
+
+        for (name, buffer0, buffer1) in zip(columns, buffers...)
+            LibCasacore.addreader!(
+                reader, table[name].columnref,
+                convert(Ptr{Cvoid}, pointer(buffer0)), convert(Ptr{Cvoid}, pointer(buffer1))
+            )
+        end
+
+        it = new{columns, typeof(buffers[1])}(table, rows, buffers, reader)
+
+        # A read may still be in progress into the buffers when the iterator is abandoned
+        finalizer(it) do it
+            try
+                LibCasacore.wait!(it.reader)
+            catch
+            end
         end
+        return it
+    end
+end
+
+# Buffers hold the (scalar or fixed shape) cells of all rows in a chunk
+function _chunkbuffer(c::Column{T, N}, rows::Int) where {T, N}
+    if !_isnative(c)
+        throw(ArgumentError("Column $(c.name) has string or variably shaped cells and cannot be buffered"))
+    end
+    return Array{T, N}(undef, size(c)[1:end - 1]..., rows)
+end
+
+Base.IteratorSize(::Type{<:ChunkIterator}) = Base.HasLength()
+Base.length(it::ChunkIterator) = cld(size(it.table, 1), it.rows)
+
+function Base.iterate(it::ChunkIterator{C}, (start, b)=(1, 1)) where C
+    nrow = size(it.table, 1)
+    start > nrow && return nothing
+
+    # The first chunk is read synchronously; subsequent chunks have already been prefetched
+    if start == 1
+        LibCasacore.prefetch!(it.reader, 0, min(it.rows, nrow), b - 1)
+    end
+    LibCasacore.wait!(it.reader)
+
+    stop = min(start + it.rows - 1, nrow)
+    if stop < nrow
+        LibCasacore.prefetch!(it.reader, stop, min(it.rows, nrow - stop), 2 - b)
+    end
+
+    views = map(it.buffers[b]) do buffer
+        selectdim(buffer, ndims(buffer), 1:(stop - start + 1))
+    end
+    return NamedTuple{(:rows, C...)}((start:stop, views...)), (stop + 1, 3 - b)
+end
+
+# Scalar and fixed shape columns of non-string types can be read and written natively in bulk
+_isnative(::Column{T}) where T = !(T <: Union{Array, String})
+
+"""
+    vcat(tables::Table...)
 
-        # Otherwise delete existing table
-        LibCasacore.deleteSubTable(parent.tableref, namestr, true)
+Concatenate the rows of `tables` into a single table, without copying their data. The tables must
+have the same columns, and remain open for as long as the concatenated table is in use.
+"""
+function Base.vcat(table::Table, tables::Table...)
+    tablesvec = _tablesvec(table, tables...)
+    return GC.@preserve table tables Table(LibCasacore.concatTables(tablesvec))
+end
+
+"""
+    readparallel(tables, column::Symbol; nthreads=Sys.CPU_THREADS)
+
+Read the scalar or fixed shape array `column` of each of `tables` into a single array, whose last
+dimension spans the rows of all tables in turn (as `vcat(tables...)[column][:]` would). The tables
+are read concurrently on up to `nthreads` native threads, each reading whole tables. Tables that
+share a root table (e.g. the same table given twice, or selections of one table) are read in turn
+by a single thread.
+"""
+function readparallel(tables, column::Symbol; kwargs...)
+    columns = _parallelcolumns(tables, column)
+    dest = _chunkbuffer(first(columns), sum(c -> size(c)[end], columns))
+    return _readparallel!(dest, columns; kwargs...)
+end
+
+"""
+    readparallel!(dest::StridedArray, tables, column::Symbol; nthreads=Sys.CPU_THREADS)
+
+Read `column` of each of `tables` concurrently into the preallocated, contiguous array `dest`, as
+for `readparallel()`.
+"""
+function readparallel!(dest::StridedArray, tables, column::Symbol; kwargs...)
+    return _readparallel!(dest, _parallelcolumns(tables, column); kwargs...)
+end
+
+function _parallelcolumns(tables, column::Symbol)
+    columns = [table[column] for table in tables]
+    if isempty(columns)
+        throw(ArgumentError("At least one table is required"))
     end
+    for c in columns
+        if !_isnative(c)
+            throw(ArgumentError("Column $(column) has string or variably shaped cells and cannot be read in parallel"))
+        end
+        if _celltype(c) != _celltype(first(columns)) || size(c)[1:end - 1] != size(first(columns))[1:end - 1]
+            throw(DimensionMismatch("Column $(column) must have the same type and cell shape in all tables"))
+        end
+    end
+    return columns
+end
+
+_celltype(::Column{T}) where T = T
+
+function _readparallel!(dest::StridedArray{T}, columns::AbstractVector{<:Column}; nthreads::Int=Sys.CPU_THREADS) where T
+    nthreads > 0 || throw(ArgumentError("At least one thread is required"))
+
+    c = first(columns)
+    if T != _celltype(c)
+        throw(ArgumentError("Cannot read Column of type $(_celltype(c)) into destination of type $(T)"))
+    end
+    shape = (size(c)[1:end - 1]..., sum(x -> size(x)[end], columns))
+    if size(dest) != shape
+        throw(DimensionMismatch("Cannot read columns of combined size $(shape) into destination of size $(size(dest))"))
+    end
+    if strides(dest) != Base.size_to_strides(1, size(dest)...)
+        throw(ArgumentError("Destination of readparallel!() must be contiguous in memory"))
+    end
+
+    reader = LibCasacore.ParallelReader(nthreads)
+    GC.@preserve dest columns begin
+        offset = 0
+        for c in columns
+            if length(c) > 0
+                LibCasacore.addreader!(reader, c.columnref, convert(Ptr{Cvoid}, pointer(dest, offset + 1)))
+            end
+            offset += length(c)
+        end
+        LibCasacore.run!(reader)
+    end
+
+    return dest
+end
+
+"""
+    append!(table::Table, columns::NamedTuple)
+
+Append rows to `table`, writing the values of `columns` (e.g. `(TIME=times, DATA=data)`) into
+them. Each value holds all appended rows of its column, laid out as when reading the column: a
+vector for scalar columns and columns of variably shaped cells, and an array with the rows as its
+last dimension for fixed shape columns. Columns that are not given are left undefined.
+
+The rows are added and the scalar and fixed shape columns are written in a single call. If any
+column cannot be written, the appended rows are removed again (where the table's storage managers
+allow rows to be removed) before the error is rethrown. To coalesce many small appends, use an
+`Appender`.
+"""
+function Base.append!(x::Table, columns::NamedTuple)
+    cols = map(name -> x[name], keys(columns))
+    n = _appendlength(keys(columns), map(Tuple(columns), cols) do v, c
+        _isnative(c) ? _appendrows(c.name, v, size(c)[1:(end - 1)]) : length(v)
+    end)
+
+    # Keep references to (possibly converted) values until they are written
+    appender = LibCasacore.RowAppender(x.tableref)
+    values = []
+    for (v, c) in zip(columns, cols)
+        if _isnative(c)
+            v = _appendvalue(c, v)
+            push!(values, v)
+            LibCasacore.addwriter!(appender, c.columnref, convert(Ptr{Cvoid}, pointer(v)))
+        end
+    end
+    start = Int(GC.@preserve values LibCasacore.appendrows!(appender, n))
+
+    # Strings and variably shaped cells are written separately, removing the appended rows again
+    # should any of these writes fail
+    try
+        for (v, c) in zip(columns, cols)
+            if !_isnative(c)
+                c[(start + 1):(start + n)] = v
+            end
+        end
+    catch
+        LibCasacore.removerows!(appender, start, n)
+        rethrow()
+    end
+
+    return x
+end
+
+_appendvalue(::Column{T, N}, v) where {T, N} = convert(Array{T, N}, v)
+
+# Check that v holds whole cells of shape cellshape, and return its number of rows
+function _appendrows(name::Symbol, v, cellshape::Tuple)
+    if ndims(v) != length(cellshape) + 1 || size(v)[1:(end - 1)] != cellshape
+        throw(DimensionMismatch("Cannot append array of size $(size(v)) to column $(name) with cells of size $(cellshape)"))
+    end
+    return size(v, ndims(v))
+end
+
+function _appendlength(names, ns)
+    if !allequal(ns)
+        throw(DimensionMismatch("Cannot append differing numbers of rows $(ns) to columns $(names)"))
+    end
+    return isempty(ns) ? 0 : first(ns)
+end
+
+"""
+    Appender(table::Table, columns; rows=4096)
+    Appender(f, table::Table, columns; rows=4096)
+
+Coalesce small appends to the scalar or fixed shape `columns` of `table` into batches of `rows`.
+Values passed to `append!(appender, values::NamedTuple)` are copied into preallocated buffers,
+which are appended to the table in a single call each time they fill, and when the appender is
+flushed (with `Tables.flush`) or `close`d. Until then, buffered rows are not part of the table.
+
+The second form calls `f(appender)` and then closes the appender.
+"""
+mutable struct Appender{C, B}
+    const table::Table
+    const rows::Int
+    const buffers::B
+    const appender::LibCasacore.RowAppenderAllocated
+    n::Int
+
+    function Appender(table::Table, columns; rows::Int=4096)
+        rows > 0 || throw(ArgumentError("Appender must buffer a positive number of rows"))
+        columns = Tuple(Symbol.(columns))
+
+        appender = LibCasacore.RowAppender(table.tableref)
+        buffers = map(name -> _chunkbuffer(table[name], rows), columns)
+        for (name, buffer) in zip(columns, buffers)
+            LibCasacore.addwriter!(appender, table[name].columnref, convert(Ptr{Cvoid}, pointer(buffer)))
+        end
+
+        return new{columns, typeof(buffers)}(table, rows, buffers, appender, 0)
+    end
+end
+
+function Appender(f, table::Table, columns; kwargs...)
+    appender = Appender(table, columns; kwargs...)
+    try
+        return f(appender)
+    finally
+        close(appender)
+    end
+end
+
+function Base.append!(a::Appender{C}, values::NamedTuple) where C
+    if !issetequal(keys(values), C)
+        throw(ArgumentError("Appender expects values for columns $(C), got $(keys(values))"))
+    end
+
+    n = _appendlength(C, map(C, a.buffers) do name, buffer
+        _appendrows(name, values[name], size(buffer)[1:(end - 1)])
+    end)
+
+    offset = 0
+    while offset < n
+        m = min(a.rows - a.n, n - offset)
+        for (name, buffer) in zip(C, a.buffers)
+            cellsize = length(buffer) ÷ a.rows
+            copyto!(buffer, a.n * cellsize + 1, values[name], offset * cellsize + 1, m * cellsize)
+        end
+        a.n += m
+        offset += m
+        a.n == a.rows && flush(a)
+    end
+
+    return a
+end
+
+function flush(a::Appender)
+    if a.n > 0
+        GC.@preserve a LibCasacore.appendrows!(a.appender, a.n)
+        a.n = 0
+    end
+    return a
+end
+
+Base.close(a::Appender) = (flush(a); nothing)
+
+"""
+    WriteQueue(table::Table; maxbytes=256 * 2^20)
+
+Write to the scalar and fixed shape columns of `table` asynchronously. Assigning to a column of
+the queue, e.g. `queue[:DATA][:, :, rows] = data`, copies the values and returns, whilst they are
+written on a background thread. This blocks if more than `maxbytes` of writes are pending.
 
-    # We do a copy, rather than a rename. This avoids mutating the sub, which is closer in
-    # in line with the semantics of setproperty!().
-    LibCasacore.deepCopy(sub.tableref, pathstr, Int(New))
-    sub = LibCasacore.Table(pathstr, Int(Old))
+`flush(queue; fsync=true, recursive=true)` waits until all writes have completed, rethrowing the
+first error raised by any of them, and then flushes the table as `flush(table)` does. Once a write
+fails, the writes queued after it are discarded. The table must not otherwise be accessed until
+the queue has been flushed.
 
-    LibCasacore.defineTable(
-        LibCasacore.rwKeywordSet(parent.tableref), LibCasacore.RecordFieldId(namestr), sub
+The queue must be flushed before it is released: a queue that is garbage collected still completes
+its writes, but any error can then only be reported on stderr.
+"""
+struct WriteQueue
+    table::Table
+    queueref::LibCasacore.WriteQueueAllocated
+end
+
+function WriteQueue(table::Table; maxbytes::Int=256 * 2^20)
+    maxbytes > 0 || throw(ArgumentError("Write queue must allow a positive number of pending bytes"))
+    return WriteQueue(table, LibCasacore.WriteQueue(maxbytes))
+end
+
+struct AsyncColumn{T, N, S}
+    queue::WriteQueue
+    column::Column{T, N, S}
+end
+
+function Base.getindex(q::WriteQueue, name::Symbol)
+    c = q.table[name]
+    if !_isnative(c)
+        throw(ArgumentError("Column $(name) has string or variably shaped cells and cannot be written asynchronously"))
+    end
+    return AsyncColumn(q, c)
+end
+
+Base.size(c::AsyncColumn) = size(c.column)
+
+function flush(q::WriteQueue; fsync=true, recursive=true)
+    LibCasacore.wait!(q.queueref)
+    flush(q.table; fsync, recursive)
+    return q
+end
+
+# As for Column, but the values are copied (only once, if already an Array of the column type)
+# and enqueued instead of written
+_asyncvalue(::Type{T}, v::Array{T}) where T = v
+_asyncvalue(::Type{T}, v) where T = collect(T, v)
+
+function Base.setindex!(ac::AsyncColumn{T, 1, <:LibCasacore.ScalarColumn}, v, i::RowIndexTypes) where T
+    c = ac.column
+    @boundscheck checkbounds(c, i)
+    i, = to_indices(c, (i,))
+
+    varray = _asyncvalue(T, v)
+    Base.setindex_shape_check(varray, length(i))
+
+    GC.@preserve varray begin
+        vectorslice = LibCasacore.Vector{LibCasacore.getcxxtype(T)}(
+            LibCasacore.IPosition(Tuple(length(i))),
+            convert(Ptr{Cvoid}, pointer(varray)),
+            LibCasacore.SHARE
+        )
+        LibCasacore.enqueueput!(ac.queue.queueref, c.columnref, _rowselection(i), vectorslice)
+    end
+
+    return v
+end
+
+function Base.setindex!(ac::AsyncColumn{T, N, <:LibCasacore.ArrayColumn}, v, i::RowIndexTypes, I::RowIndexTypes...) where {T, N}
+    c = ac.column
+    I = (i, I...)
+    @boundscheck checkbounds(c, I...)
+    I = to_indices(c, I)
+    _checkcellindices(I[1:(end - 1)])
+
+    varray = _asyncvalue(T, v)
+    Base.setindex_shape_check(varray, length.(I)...)
+
+    # 1- to 0-based indexing
+    rows = _rowselection(I[end])
+    cellslicer = LibCasacore.Slicer(broadcast(.-, I[1:(end - 1)], 1)...)
+
+    GC.@preserve varray begin
+        arrayslice = LibCasacore.Array{LibCasacore.getcxxtype(T)}(
+            LibCasacore.IPosition(length.(I)),
+            convert(Ptr{Cvoid}, pointer(varray)),
+            LibCasacore.SHARE
+        )
+        LibCasacore.enqueueput!(ac.queue.queueref, c.columnref, rows, cellslicer, arrayslice)
+    end
+
+    return v
+end
+
+"""
+    statistics(c::Column; flags=nothing, rows=10_000)
+
+Compute statistics of the scalar or fixed shape column `c` without reading it into memory, by
+streaming through it in chunks of `rows` rows. Samples set in the boolean column `flags` (e.g.
+`:FLAG` for `:DATA`, or `:FLAG_ROW` for a scalar column), which must have the same shape, are
+excluded. Statistics of complex columns are computed over amplitudes.
+
+Returns a NamedTuple of the `count` of unflagged samples, the fraction of samples `flagged`, and
+the `min`, `max`, `mean` and (population) `std` of the unflagged samples. If there are no
+unflagged samples (e.g. the column is empty or fully flagged), `min`, `max`, `mean` and `std` are
+`NaN`, as is `flagged` for an empty column.
+"""
+function statistics(c::Column; flags::Union{Nothing, Symbol}=nothing, rows::Int=10_000)
+    if !_isnative(c)
+        throw(ArgumentError("Column $(c.name) has string or variably shaped cells and has no statistics"))
+    end
+    rows > 0 || throw(ArgumentError("Chunks must have a positive number of rows"))
+
+    out = zeros(6)
+    GC.@preserve out begin
+        LibCasacore.statistics!(c.columnref, LibCasacore.String(_optionalname(flags)), rows, pointer(out))
+    end
+
+    n, nflagged, min, max, mean, m2 = out
+    if n == 0
+        return (count=0, flagged=nflagged > 0 ? 1.0 : NaN, min=NaN, max=NaN, mean=NaN, std=NaN)
+    end
+    return (
+        count=Int(n),
+        flagged=nflagged / (n + nflagged),
+        min=min,
+        max=max,
+        mean=mean,
+        std=sqrt(m2 / n),
     )
+end
+
+_optionalname(name::Nothing) = ""
+_optionalname(name::Symbol) = string(name)
+
+"""
+    average(c::Column, bins; flags=nothing, weights=nothing, rows=10_000)
+
+Average the fixed shape, floating point or complex column `c` in `bins`, which gives the number
+of samples to average along each dimension of the column, including the rows (e.g. `(1, 4, 10)`
+averages 4 channels and 10 consecutive rows of a `DATA` column). Trailing bins may be partial.
+The column is streamed through in chunks of (about) `rows` rows, and never read in full.
+
+Samples are weighted by the `weights` column, whose cells match the leading axes of the cells of
+`c` (e.g. `:WEIGHT` or `:WEIGHT_SPECTRUM`), and excluded if set in the `flags` column.
+
+Returns a NamedTuple of the averaged `data` and the total `weight` of each bin, which is zero for
+bins whose samples are all flagged.
+
+For a MeasurementSet, average over time per baseline by combining with `eachgroup()`:
 
-    return Table(sub)  # Or return the original sub table?
+    for group in Tables.eachgroup(ms, :ANTENNA1, :ANTENNA2)
+        avg = Tables.average(group[:DATA], (1, 4, 10); flags=:FLAG, weights=:WEIGHT)
+    end
+"""
+function average(
+    c::Column{T, N, <:LibCasacore.ArrayColumn}, bins::NTuple{N, Int};
+    flags::Union{Nothing, Symbol}=nothing, weights::Union{Nothing, Symbol}=nothing, rows::Int=10_000
+) where {T <: Union{AbstractFloat, Complex{<:AbstractFloat}}, N}
+    if !all(>(0), bins)
+        throw(ArgumentError("Bins must have positive sizes"))
+    end
+    rows > 0 || throw(ArgumentError("Chunks must have a positive number of rows"))
+
+    shape = cld.(size(c), bins)
+    data = Array{T, N}(undef, shape)
+    weight = Array{Float64, N}(undef, shape)
+    GC.@preserve data weight begin
+        LibCasacore.average!(
+            c.columnref, LibCasacore.String(_optionalname(flags)), LibCasacore.String(_optionalname(weights)),
+            LibCasacore.IPosition(bins[1:(end - 1)]), bins[end], rows,
+            convert(Ptr{Cvoid}, pointer(data)), pointer(weight)
+        )
+    end
+
+    return (data=data, weight=weight)
 end
 
-flush(x::Table; fsync=true, recursive=true) = LibCasacore.flush(x.tableref, fsync, recursive)
+function average(c::Column, bins::Tuple; kwargs...)
+    throw(ArgumentError("Only fixed shape, floating point or complex columns can be averaged, with a bin size for each dimension"))
+end
 
-function taql(command::String, table::Table, tables::Vararg{Table})
-    tablesvec = LibCasacore.StdVector{LibCasacore.ConstCxxPtr{LibCasacore.Table}}()
-    for table in (table, tables...)
-        push!(tablesvec, Ref(LibCasacore.ConstCxxPtr(table.tableref)))
+"""
+    eachgroup(table::Table, columns::Symbol...; order=:ascending, sort=true)
+
+Iterate over groups of rows of `table` that share the same values in `columns` (e.g. `:TIME`, or
+`:ANTENNA1, :ANTENNA2`), using casacore's TableIterator. Each group is a `Table` that references
+the rows of the parent table, so that only the columns that are used are read, and only for the
+rows of that group.
+
+The table is first sorted by `columns` in the given `order` (`:ascending` or `:descending`). If
+the table is already ordered, `sort=false` skips sorting and groups consecutive rows only.
+"""
+function eachgroup(table::Table, columns::Symbol...; order::Symbol=:ascending, sort::Bool=true)
+    if isempty(columns)
+        throw(ArgumentError("At least one column is required to group by"))
+    end
+    if order ∉ (:ascending, :descending)
+        throw(ArgumentError("Unknown order $(order); expected :ascending or :descending"))
     end
 
+    keys = LibCasacore.StdVector([LibCasacore.StdString(string(column)) for column in columns])
+    iterref = LibCasacore.TableIterator(
+        table.tableref,
+        keys,
+        order === :ascending ? LibCasacore.IteratorAscending : LibCasacore.IteratorDescending,
+        sort ? LibCasacore.IteratorParSort : LibCasacore.IteratorNoSort
+    )
+    return GroupIterator(table, iterref)
+end
+
+struct GroupIterator
+    parent::Table
+    iterref::LibCasacore.TableIteratorAllocated
+end
+
+Base.IteratorSize(::Type{GroupIterator}) = Base.SizeUnknown()
+Base.eltype(::Type{GroupIterator}) = Table
+
+function Base.iterate(it::GroupIterator, started=false)
+    if started
+        LibCasacore.next!(it.iterref)
+    else
+        LibCasacore.reset!(it.iterref)
+    end
+
+    Bool(LibCasacore.pastEnd(it.iterref)) && return nothing
+    return Table(LibCasacore.table(it.iterref)), true
+end
+
+function taql(command::String, table::Table, tables::Vararg{Table})
+    tablesvec = _tablesvec(table, tables...)
+
     GC.@preserve table tables begin
         return Table(LibCasacore.tableCommand(
             command,
@@ -885,6 +2004,55 @@ function taql(command::String, table::Table, tables::Vararg{Table})
     end
 end
 
+function _tablesvec(tables::Table...)
+    tablesvec = LibCasacore.StdVector{LibCasacore.ConstCxxPtr{LibCasacore.Table}}()
+    for table in tables
+        push!(tablesvec, Ref(LibCasacore.ConstCxxPtr(table.tableref)))
+    end
+    return tablesvec
+end
+
+"""
+    taqlrows(command::String, table::Table, [tables::Table...])
+
+Run the TaQL selection `command`, and return only the (1-based) numbers of the selected rows in
+`table` (i.e. `\$1`), rather than a derived table. These can be used to index columns directly,
+e.g. `table[:DATA][:, :, rows]`.
+"""
+function taqlrows(command::String, table::Table, tables::Vararg{Table})
+    tablesvec = _tablesvec(table, tables...)
+
+    rows = GC.@preserve table tables LibCasacore.taqlrows(command, tablesvec)
+    return Int[row + 1 for row in rows]
+end
+
+"""
+    taqlcalc!(dest::Array, command::String, table::Table, [tables::Table...])
+
+Evaluate the TaQL `CALC` `command` natively, writing its value for each row directly into `dest`.
+For scalar valued expressions, `dest` has one element per row; for array valued expressions, it
+holds the elements of each row consecutively (e.g. of size `(3, nrows)` for `CALC UVW * 2`).
+`dest` may have element type `Float64`, `ComplexF64`, `Int64` or `Bool`, into which the expression
+is converted.
+
+For example, to compute baseline lengths:
+
+    lengths = Vector{Float64}(undef, size(table, 1))
+    taqlcalc!(lengths, raw"CALC sqrt(sumsqr(UVW)) FROM \$1", table)
+"""
+function taqlcalc!(
+    dest::Array{T}, command::String, table::Table, tables::Vararg{Table}
+) where {T <: Union{Float64, ComplexF64, Int64, Bool}}
+    tablesvec = _tablesvec(table, tables...)
+
+    GC.@preserve dest table tables begin
+        LibCasacore.taqlcalc!(
+            command, tablesvec, convert(Ptr{LibCasacore.getcxxtype(T)}, pointer(dest)), length(dest)
+        )
+    end
+    return dest
+end
+
 function zerodim_as_scalar(x::Array{T, 0}) where T
     return x[]
 end
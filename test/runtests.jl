@@ -47,6 +47,180 @@ using Unitful
             @test LibCasacore.getType(LibCasacore.getRef(direction.m)) == Int(Measures.Directions.B1950)
         end
 
+        @testset "Batched direction conversion" begin
+            pos = Measures.Position(:MWA32T)
+            t = Measures.Epoch(Measures.Epochs.UTC, 59857u"d")
+            c = Measures.Converter(Measures.Directions.J2000, Measures.Directions.AZEL, t, pos)
+
+            ras, decs = 2π * rand(100), π * rand(100) .- π/2
+            lmns = permutedims(hcat(cos.(decs) .* cos.(ras), cos.(decs) .* sin.(ras), sin.(decs)))
+            azels = mconvert(c, lmns)
+            @test size(azels) == (3, 100)
+
+            for (ra, dec, azel) in zip(ras, decs, eachcol(azels))
+                expected = mconvert(
+                    Measures.Directions.AZEL, Measures.Direction(Measures.Directions.J2000, ra * u"rad", dec * u"rad"), t, pos
+                )
+                @test atan(azel[2], azel[1]) * u"rad" ≈ expected.long
+                @test asin(azel[3]) * u"rad" ≈ expected.lat
+            end
+
+            @test_throws DimensionMismatch mconvert!(zeros(3, 99), lmns, c)
+
+            # Broadcasting reuses the converter
+            dirs = [Measures.Direction(Measures.Directions.J2000, ra * u"rad", dec * u"rad") for (ra, dec) in zip(ras, decs)]
+            outs = [zero(Measures.Direction) for _ in dirs]
+            mconvert!.(outs, dirs, c)
+            @test all(out.type == Measures.Directions.AZEL for out in outs)
+            @test outs[1].long ≈ atan(azels[2, 1], azels[1, 1]) * u"rad"
+        end
+
+        @testset "Time series direction conversion" begin
+            pos = Measures.Position(:MWA32T)
+            t = Measures.Epoch(Measures.Epochs.UTC, 59857u"d")
+            direction = Measures.Direction(Measures.Directions.J2000, 1u"rad", -0.5u"rad")
+
+            times = 59857u"d" .+ (0:23) * 1u"hr"
+            azels = mconvert(Measures.Directions.AZEL, direction, times, t, pos)
+            @test length(azels) == 24
+            @test all(azel.type == Measures.Directions.AZEL for azel in azels)
+            @test !(azels[1] ≈ azels[2])
+
+            for (time, azel) in zip(times, azels)
+                t.time = time
+                @test isapprox(azel, mconvert(Measures.Directions.AZEL, direction, t, pos), atol=1e-8)
+            end
+
+            # The converter, and its frame, are unchanged by a time series conversion
+            t.time = 59857.5u"d"
+            c = Measures.Converter(direction, Measures.Directions.AZEL, t, pos)
+            expected = mconvert!(zero(direction), direction, c)
+            mconvert!(Matrix{Float64}(undef, 3, 24), direction, c, times)
+            @test mconvert!(zero(direction), direction, c) == expected
+
+            @test_throws ArgumentError mconvert(Measures.Directions.AZEL, direction, times, pos)
+        end
+
+        @testset "Approximate time series conversion" begin
+            pos = Measures.Position(:MWA32T)
+            t = Measures.Epoch(Measures.Epochs.UTC, 59857u"d")
+            direction = Measures.Direction(Measures.Directions.J2000, 1u"rad", -0.5u"rad")
+            times = 59857u"d" .+ (0:4999) * 1u"s"
+
+            exact = mconvert(Measures.Directions.AZEL, direction, times, t, pos)
+            approx = mconvert(Measures.Directions.AZEL, direction, times, t, pos; maxerror=1e-3u"arcsecond")
+            @test all(zip(exact, approx)) do (a, b)
+                isapprox(a, b, atol=ustrip(u"rad", 2e-3u"arcsecond"))
+            end
+
+            freq = Measures.Frequency(Measures.Frequencies.LSRK, 150e6u"Hz")
+            c = Measures.Converter(freq, Measures.Frequencies.TOPO, t, pos, direction)
+            exact = mconvert!(zeros(1, length(times)), freq, c, times)
+            approx = mconvert!(zeros(1, length(times)), freq, c, times; maxerror=1e-3u"Hz")
+            @test maximum(abs.(exact .- approx)) < 2e-3
+
+            @test_throws ArgumentError mconvert!(zeros(1, length(times)), freq, c, times; maxerror=1u"m")
+        end
+
+        @testset "Converter cache" begin
+            Measures.emptycache!()
+            pos = Measures.Position(:MWA32T)
+            t = Measures.Epoch(Measures.Epochs.UTC, 59857u"d")
+            direction = Measures.Direction(Measures.Directions.J2000, 1u"rad", -0.5u"rad")
+
+            expected = mconvert!(zero(direction), direction, Measures.Converter(direction, Measures.Directions.AZEL, t, pos))
+            for _ in 1:10
+                @test mconvert(Measures.Directions.AZEL, direction, t, pos) ≈ expected
+            end
+            @test Measures.cachestats().misses == 1
+            @test Measures.cachestats().hits == 9
+
+            # A different frame is a new cache entry
+            t2 = Measures.Epoch(Measures.Epochs.UTC, 59858u"d")
+            @test !(mconvert(Measures.Directions.AZEL, direction, t2, pos) ≈ expected)
+            @test Measures.cachestats().misses == 2
+            @test Measures.cachestats().length == 2
+
+            # Epochs within the same day are also distinct entries
+            morning = Measures.Epoch(Measures.Epochs.UTC, 59857.25u"d")
+            evening = Measures.Epoch(Measures.Epochs.UTC, 59857.75u"d")
+            azel = mconvert(Measures.Directions.AZEL, direction, morning, pos)
+            @test mconvert(Measures.Directions.AZEL, direction, evening, pos) ≈
+                mconvert!(zero(direction), direction, Measures.Converter(direction, Measures.Directions.AZEL, evening, pos))
+            @test !(mconvert(Measures.Directions.AZEL, direction, evening, pos) ≈ azel)
+            @test Measures.cachestats().length == 4
+
+            # Cached converters may be used concurrently
+            results = fetch.([Threads.@spawn mconvert(Measures.Directions.AZEL, direction, t, pos) for _ in 1:8])
+            @test all(r -> r ≈ expected, results)
+
+            # Least recently used entries are evicted
+            Measures.emptycache!(capacity=2)
+            mconvert(Measures.Directions.AZEL, direction, t, pos)
+            mconvert(Measures.Directions.AZEL, direction, t2, pos)
+            mconvert(Measures.Directions.AZEL, direction, t, pos)
+            mconvert(Measures.Directions.HADEC, direction, t, pos)
+            @test Measures.cachestats().length == 2
+            mconvert(Measures.Directions.AZEL, direction, t, pos)
+            @test Measures.cachestats().hits == 2
+
+            Measures.emptycache!(capacity=64)
+        end
+
+        @testset "Parallel conversions" begin
+            pos = Measures.Position(:MWA32T)
+            t = Measures.Epoch(Measures.Epochs.UTC, 59857u"d")
+            c = Measures.Converter(Measures.Directions.J2000, Measures.Directions.AZEL, t, pos)
+
+            ras, decs = 2π * rand(1000), π * rand(1000) .- π/2
+            lmns = permutedims(hcat(cos.(decs) .* cos.(ras), cos.(decs) .* sin.(ras), sin.(decs)))
+            @test mconvert(c, lmns; threads=4) ≈ mconvert(c, lmns)
+
+            direction = Measures.Direction(Measures.Directions.J2000, 1u"rad", -0.5u"rad")
+            times = 59857u"d" .+ (0:99) * 1u"minute"
+            serial = mconvert(Measures.Directions.AZEL, direction, times, t, pos)
+            parallel = mconvert(Measures.Directions.AZEL, direction, times, t, pos; threads=4)
+            @test all(isapprox(a, b, atol=1e-10) for (a, b) in zip(serial, parallel))
+
+            # Inputs with a frame of their own are converted serially, as that frame is not
+            # safe to share between threads
+            hadec = Measures.Direction(Measures.Directions.HADEC, 0.1u"rad", -0.5u"rad", t, pos)
+            c = Measures.Converter(hadec, Measures.Directions.J2000, t, pos)
+            @test !c.plainmodel
+            @test mconvert(c, lmns; threads=4) == mconvert(c, lmns)
+
+            serial = mconvert(Measures.Directions.AZEL, hadec, times, t, pos)
+            parallel = mconvert(Measures.Directions.AZEL, hadec, times, t, pos; threads=4)
+            @test all(a == b for (a, b) in zip(serial, parallel))
+        end
+
+        @testset "Conversion statistics" begin
+            c = Measures.Converter(Measures.Directions.J2000, Measures.Directions.GALACTIC)
+            direction = Measures.Direction(Measures.Directions.J2000, 1u"rad", -0.5u"rad")
+            lmns = rand(3, 100)
+
+            Measures.resetstats!()
+            mconvert!(zero(direction), direction, c)
+            @test isempty(Measures.stats())
+
+            Measures.instrument!()
+            for _ in 1:3
+                mconvert!(zero(direction), direction, c)
+            end
+            mconvert(c, lmns)
+            Measures.instrument!(false)
+            mconvert(c, lmns)
+
+            stats = Measures.stats()
+            @test collect(keys(stats)) == [Measures.Direction]
+            @test stats[Measures.Direction].calls == 4
+            @test stats[Measures.Direction].conversions == 103
+            @test stats[Measures.Direction].seconds > 0
+
+            Measures.resetstats!()
+            @test isempty(Measures.stats())
+        end
+
         @testset "Frequency conversion REST to LSRD" begin
             freq = Measures.Frequency(Measures.Frequencies.REST, 1_420_405_752u"Hz")
             show(devnull, freq)
@@ -115,6 +289,39 @@ using Unitful
             uvw = Measures.UVW(Measures.UVWs.J2000, baseline, refdirection)
         end
 
+        @testset "UVW generation" begin
+            positions = [
+                -2.55952e6 -2.55949e6 -2.55958e6 -2.55942e6;
+                 5.09538e6  5.09544e6  5.09535e6  5.09531e6;
+                -2.84901e6 -2.84897e6 -2.84903e6 -2.84913e6
+            ]
+            ant1 = [1, 1, 1, 2, 2, 3, 1, 1, 1, 2, 2, 3]
+            ant2 = [2, 3, 4, 3, 4, 4, 2, 3, 4, 3, 4, 4]
+            times = [fill(5.1e9, 6); fill(5.1e9 + 3600, 6)]
+            phasecentre = Measures.Direction(Measures.Directions.J2000, 27u"°", -25u"°")
+
+            uvws = Measures.UVWs.uvws(positions, ant1, ant2, times, phasecentre)
+            @test size(uvws) == (3, 12)
+
+            # Baseline lengths are preserved, and rotate with time
+            lengths = map(i -> hypot((positions[:, ant2[i]] - positions[:, ant1[i]])...), 1:12)
+            @test all(isapprox.(map(uvw -> hypot(uvw...), eachcol(uvws)), lengths; rtol=1e-6))
+            @test !(uvws[:, 1:6] ≈ uvws[:, 7:12])
+
+            # Compare against per-baseline calculation
+            refpos = Measures.Position(Measures.Positions.ITRF, (positions[:, 1] * u"m")...)
+            t = Measures.Epoch(Measures.Epochs.UTC, times[1] * u"s")
+            baseline = Measures.Baseline(
+                Measures.Baselines.ITRF, ((positions[:, 2] - positions[:, 1]) * u"m")...
+            )
+            baseline = mconvert(Measures.Baselines.J2000, baseline, phasecentre, refpos, t)
+            uvw = Measures.UVW(Measures.UVWs.J2000, baseline, phasecentre)
+            @test isapprox([uvw.u, uvw.v, uvw.w], uvws[:, 1] * u"m"; atol=1e-6u"m")
+
+            @test uvws == Measures.UVWs.uvws(positions, ant1, ant2, times, phasecentre; threads=4)
+            @test_throws ArgumentError Measures.UVWs.uvws(positions, ant1, ant2 .+ 4, times, phasecentre)
+        end
+
         @testset "Doppler conversions" begin
             doppler = Measures.Doppler(Measures.Dopplers.RADIO, 20_000u"km/s")
             @test (doppler.doppler = 2) == 2
@@ -138,6 +345,50 @@ using Unitful
             doppleragain = Measures.Doppler(rv)
             @test doppler ≈ doppleragain
         end
+
+        @testset "Preloading" begin
+            @test Measures.preload!(59857, 59860) >= 0
+            @test Measures.preload!(59857u"d", 59860u"d") >= 0
+            @test_throws ArgumentError Measures.preload!(59860, 59857)
+
+            # Snapshots redirect the process wide measures directory, and so are tested in a fresh
+            # process, configured through the environment as when loading Casacore in production
+            ut1(mjd) = sum(LibCasacore.getVector(
+                mconvert(Measures.Epochs.UT1, Measures.Epoch(Measures.Epochs.UTC, mjd * u"d")).m
+            ))
+            inrange, outofrange = ut1(59858.5), ut1(59000.5)
+
+            snapshot = joinpath(mktempdir(), "measures")
+            script = """
+                using Casacore.LibCasacore, Casacore.Measures, Casacore.Tables, Test, Unitful
+                ut1(mjd) = sum(LibCasacore.getVector(
+                    mconvert(Measures.Epochs.UT1, Measures.Epoch(Measures.Epochs.UTC, mjd * u"d")).m
+                ))
+
+                @testset "Snapshot" begin
+                    @test String(LibCasacore.measuresDir(LibCasacore.juliastate)) == $(repr(snapshot))
+                    @test isdir(joinpath($(repr(snapshot)), "geodetic"))
+                    @test isdir(joinpath($(repr(snapshot)), "ephemerides"))
+
+                    # Daily IERS tables are restricted to the requested range
+                    eop = Tables.Table(joinpath($(repr(snapshot)), "geodetic", "IERSeop2000"))
+                    @test 0 < size(eop, 1) <= 6
+                    @test all(59856 .<= eop[:MJD][:] .<= 59861)
+
+                    # Conversions use the snapshot: UT1 - UTC is known within its range only
+                    @test ut1(59858.5) ≈ $(repr(inrange)) atol=1e-10
+                    @test abs(ut1(59000.5) - $(repr(outofrange))) * 86400 > 1e-3
+
+                    # An existing snapshot is reused
+                    @test Measures.preload!(59857, 59860; snapshot=$(repr(snapshot))) >= 0
+                end
+                """
+            cmd = addenv(
+                `$(Base.julia_cmd()) --startup-file=no --project=$(Base.active_project()) -e $(script)`,
+                "CASACORE_MEASURES_PRELOAD" => "59857:59860", "CASACORE_MEASURES_SNAPSHOT" => snapshot
+            )
+            @test success(pipeline(cmd; stdout=devnull, stderr))
+        end
     end
 
     @testset "Tables" begin
@@ -148,6 +399,59 @@ using Unitful
             @test size(table) == (0, 0)
         end
 
+        @testset "I/O modes" begin
+            path = joinpath(mktempdir(), "io.ms")
+            io = Tables.Table(path, Tables.New; io=:buffer, buffersize=1 << 20)
+            resize!(io, 100)
+            io[:DATA] = Tables.ArrayColumnDesc{ComplexF32, 2}(
+                (4, 16); datamanager=Tables.TiledColumnStMan((4, 16, 10))
+            )
+            vals = rand(ComplexF32, 4, 16, 100)
+            io[:DATA][:, :, :] = vals
+            Tables.flush(io)
+
+            for mode in (:mmap, :cache, :default)
+                @test Tables.Table(path, Tables.Old; io=mode)[:DATA][:, :, :] == vals
+            end
+
+            @test_throws ArgumentError Tables.Table(path; io=:turbo)
+            @test_throws ArgumentError Tables.Table(path; io=:buffer, buffersize=-1)
+        end
+
+        @testset "Locking" begin
+            function newtable()
+                path = joinpath(mktempdir(), "lock.ms")
+                t = Tables.Table(path, Tables.New)
+                resize!(t, 10)
+                t[:SCALAR] = collect(1:10)
+                Tables.flush(t)
+                return path
+            end
+
+            t = Tables.Table(newtable(), Tables.Update; lock=:user)
+            @test !Tables.haslock(t)
+            @test Tables.lock!(t)
+            @test Tables.haslock(t)
+            t[:SCALAR][1] = 11
+            Tables.unlock!(t)
+            @test !Tables.haslock(t)
+            @test Tables.lock!(t; write=false, attempts=1)
+            @test Tables.haslock(t; write=false)
+            @test t[:SCALAR][1] == 11
+
+            t = Tables.Table(newtable(), Tables.Update; lock=:permanent)
+            @test Tables.haslock(t)
+
+            t = Tables.Table(newtable(), Tables.Old; lock=:nolock)
+            @test t[:SCALAR][:] == 1:10
+
+            t = Tables.Table(newtable(), Tables.Old; lock=:auto, inspectioninterval=1)
+            @test t[:SCALAR][:] == 1:10
+
+            @test_throws ArgumentError Tables.Table(newtable(); lock=:exclusive)
+            @test_throws ArgumentError Tables.Table(joinpath(mktempdir(), "new.ms"), Tables.New; lock=:user)
+        end
+
         @testset "Add/remove rows" begin
             resize!(table, 10_000)
             @test size(table, 1) == 10_000
@@ -183,6 +487,40 @@ using Unitful
             end
         end
 
+        @testset "Column and subtable caching" begin
+            t = Tables.Table(joinpath(mktempdir(), "cache.ms"), Tables.New)
+            resize!(t, 10)
+            t[:A] = collect(1:10)
+            t[:B] = rand(10)
+
+            a = t[:A]
+            @test t[:A] === a
+            @test t[:B] === t[:B]
+
+            # Replacing or deleting columns invalidates cached columns
+            t[:A] = rand(10)
+            @test t[:A] !== a
+            @test typeof(t[:A]) <: Tables.Column{Float64, 1}
+            delete!(t, :B)
+            @test_throws KeyError t[:B]
+
+            @test table.ANTENNA === table.ANTENNA
+            @test table.ANTENNA[:ID] === table.ANTENNA[:ID]
+
+            # Subtables are not hidden by the caches
+            sub = Tables.Table(joinpath(mktempdir(), "sub.ms"), Tables.New)
+            for name in (:columns, :subtables, :lock)
+                setproperty!(t, name, sub)
+                @test getproperty(t, name) isa Tables.Table
+                @test getproperty(t, name) === getproperty(t, name)
+            end
+
+            # Concurrent lookups share a single cached column
+            t[:C] = rand(10)
+            cs = fetch.([Threads.@spawn t[:C] for _ in 1:16])
+            @test all(c -> c === t[:C], cs)
+        end
+
         @testset "Scalar column" begin
             @testset "Add column" begin
                 # Explicitly
@@ -222,6 +560,23 @@ using Unitful
                     @inferred column[10:20]
                 end
 
+                @testset "Row number and mask read/write" begin
+                    column = table[:SCALAR]
+                    rows = [5, 6, 7, 100, 3, 999]
+                    column[rows] = 1:6
+                    @test column[rows] == 1:6
+                    @test column[3] == 5
+                    mask = falses(1_000)
+                    mask[rows] .= true
+                    @test column[mask] == column[sort(rows)]
+                    column[mask] = zeros(6)
+                    @test all(column[rows] .== 0)
+                    @test_throws DimensionMismatch column[rows] = 1:7
+                    @test_throws BoundsError column[[1, 1_001]]
+                    @test_throws BoundsError column[falses(999)]
+                    @inferred column[rows]
+                end
+
                 @testset "Colon read/write" begin
                     column = table[:SCALAR]
                     vals = rand(1_000)
@@ -287,6 +642,9 @@ using Unitful
                     vals = [rand(ComplexF64, rand([(3,), (2, 2), (1, 2, 1)])...) for _ in 1:100]
                     column[200:299] = vals
                     @test column[200:299] == vals
+                    views = Tables.cellviews(column, 200:299)
+                    @test views == vals
+                    @test all(parent(parent(view)) === parent(parent(views[1])) for view in views)
                     column[200:299] = [[i] for i in 1:100]
                     @test column[200:299] == [[i] for i in 1:100]
                     @test_throws DimensionMismatch column[200:299] = [[i] for i in 1:101]
@@ -294,6 +652,16 @@ using Unitful
                     @inferred column[10:20]
                 end
 
+                @testset "Row number and mask read/write" begin
+                    column = table[:ARR_UNKNOWN]
+                    rows = [700, 3, 4, 5]
+                    vals = [rand(ComplexF64, 2), rand(ComplexF64, 1, 3), rand(ComplexF64, 4), rand(ComplexF64, 2, 2, 1)]
+                    column[rows] = vals
+                    @test column[rows] == vals
+                    @test column[(1:1_000) .∈ Ref(rows)] == vals[[2, 3, 4, 1]]
+                    @inferred column[rows]
+                end
+
                 @testset "Colon read/write" begin
                     column = table[:ARR_UNKNOWN]
                     vals = [rand(rand([(3,), (2, 2), (1, 2, 1)])...) for _ in 1:1000]
@@ -445,6 +813,19 @@ using Unitful
                     @inferred column[2:3, 1:2, 1:100]
                 end
 
+                @testset "Row number and mask read/write" begin
+                    column = table[:ARR]
+                    rows = [10, 11, 12, 500, 2]
+                    vals = rand(Int16, 3, 4, 5)
+                    column[:, :, rows] = vals
+                    @test column[:, :, rows] == vals
+                    @test column[2:3, 1, rows] == vals[2:3, 1, :]
+                    @test column[:, :, 2] == vals[:, :, 5]
+                    mask = (1:1_000) .∈ Ref(rows)
+                    @test column[:, :, mask] == column[:, :, sort(rows)]
+                    @test_throws ArgumentError column[[1, 3], :, rows]
+                end
+
                 @testset "Colon read/write" begin
                     column = table[:ARR]
                     vals = rand(Int16, 3, 4, 10)
@@ -514,6 +895,12 @@ using Unitful
                     column[] = vals
                     column[] == vals
                 end
+
+                # Empty and multibyte strings survive bulk transfers
+                vals = [isodd(i) ? "" : "Ω$(i)✓" for i in 1:1_000]
+                column[] = vals
+                @test column[] == vals
+                @test column[2:3] == ["Ω2✓", ""]
             end
 
             @testset "Unknown dimension columns" begin
@@ -574,6 +961,412 @@ using Unitful
             end
         end
 
+        @testset "Storage managers" begin
+            table[:TILED] = Tables.ArrayColumnDesc{ComplexF32, 2}(
+                (4, 8); datamanager=Tables.TiledColumnStMan((4, 8, 100); maxcachesize=1)
+            )
+            vals = rand(ComplexF32, 4, 8, 1_000)
+            table[:TILED][:, :, :] = vals
+            @test table[:TILED][:, :, :] == vals
+            @test table[:TILED][2, :, 501:600] == vals[2, :, 501:600]
+
+            @test Tables.tileshape(table[:TILED]) == (4, 8, 100)
+            @test Tables.maxcachesize(table[:TILED]) == 1
+            Tables.maxcachesize!(table[:TILED], 16)
+            @test Tables.maxcachesize(table[:TILED]) == 16
+            Tables.clearcache!(table[:TILED])
+            @test table[:TILED][:, 3, :] == vals[:, 3, :]
+            @test_throws ArgumentError Tables.maxcachesize!(table[:TILED], -1)
+
+            table[:TILED_SHAPE] = Tables.ArrayColumnDesc{Float64, 1}(
+                datamanager=Tables.TiledShapeStMan((16, 64))
+            )
+            cells = [rand(mod1(i, 5)) for i in 1:1_000]
+            table[:TILED_SHAPE][:] = cells
+            @test table[:TILED_SHAPE][:] == cells
+
+            table[:BUCKETED] = Tables.ScalarColumnDesc{Int32}(
+                datamanager=Tables.StandardStMan(bucketsize=4096)
+            )
+            table[:BUCKETED][:] = Int32.(1:1_000)
+            @test table[:BUCKETED][:] == 1:1_000
+
+            # Scalar columns are not tiled
+            @test_throws Exception Tables.tileshape(table[:BUCKETED])
+
+            for colname in [:TILED, :TILED_SHAPE, :BUCKETED]
+                delete!(table, colname)
+            end
+        end
+
+        @testset "Compressed columns" begin
+            # Autoscaled, with a fixed shape
+            table[:COMPRESSED] = Tables.ArrayColumnDesc{ComplexF32, 2}(
+                (4, 8); datamanager=Tables.CompressComplex()
+            )
+            @test :COMPRESSED_COMPRESSED ∈ keys(table)
+            @test typeof(table[:COMPRESSED_COMPRESSED]) <: Tables.Column{Int32, 3}
+            @test :COMPRESSED_SCALE ∈ keys(table) && :COMPRESSED_OFFSET ∈ keys(table)
+
+            vals = rand(ComplexF32, 4, 8, 1_000)
+            table[:COMPRESSED][:, :, :] = vals
+            @test typeof(table[:COMPRESSED]) <: Tables.Column{ComplexF32, 3}
+            @test isapprox(table[:COMPRESSED][:, :, :], vals; rtol=1e-3)
+
+            # Fixed scale, with variably shaped cells and a tiled stored column
+            table[:COMPRESSED_FLOAT] = Tables.ArrayColumnDesc{Float32, 1}(
+                datamanager=Tables.CompressFloat(scale=1e-3, offset=10, storage=Tables.TiledShapeStMan((16, 64)))
+            )
+            @test :COMPRESSED_FLOAT_SCALE ∉ keys(table)
+            cells = [10 .+ rand(Float32, mod1(i, 5)) for i in 1:1_000]
+            table[:COMPRESSED_FLOAT][:] = cells
+            @test all(isapprox.(table[:COMPRESSED_FLOAT][:], cells; atol=1e-3))
+
+            @test_throws ArgumentError table[:BAD] = Tables.ArrayColumnDesc{Float64, 1}(datamanager=Tables.CompressFloat())
+            @test_throws ArgumentError table[:BAD] = Tables.ScalarColumnDesc{ComplexF32}(datamanager=Tables.CompressComplex())
+
+            for colname in [
+                :COMPRESSED, :COMPRESSED_COMPRESSED, :COMPRESSED_SCALE, :COMPRESSED_OFFSET,
+                :COMPRESSED_FLOAT, :COMPRESSED_FLOAT_COMPRESSED
+            ]
+                delete!(table, colname)
+            end
+        end
+
+        @testset "Grouped iteration" begin
+            table[:GROUP] = Int32.(mod.(0:999, 4))
+            scalars = table[:SCALAR][:]
+
+            groups = collect(Tables.eachgroup(table, :GROUP))
+            @test length(groups) == 4
+            @test [group[:GROUP][1] for group in groups] == 0:3
+            @test all(group -> all(==(group[:GROUP][1]), group[:GROUP][:]), groups)
+            @test sum(group -> size(group, 1), groups) == 1_000
+            @test sum(group -> sum(group[:SCALAR][:]), groups) ≈ sum(scalars)
+
+            groups = collect(Tables.eachgroup(table, :GROUP; order=:descending))
+            @test [group[:GROUP][1] for group in groups] == 3:-1:0
+
+            # Unsorted iteration only groups consecutive rows
+            @test length(collect(Tables.eachgroup(table, :GROUP; sort=false))) == 1_000
+
+            # Read into caller provided buffers
+            buffer = zeros(1_000)
+            group = first(Tables.eachgroup(table, :GROUP))
+            n = size(group, 1)
+            copyto!(view(buffer, 1:n), group[:SCALAR])
+            @test buffer[1:n] == group[:SCALAR][:]
+            @test_throws DimensionMismatch copyto!(buffer, group[:SCALAR])
+
+            arrs = zeros(Int16, size(table[:ARR])...)
+            copyto!(arrs, table[:ARR])
+            @test arrs == table[:ARR][:, :, :]
+
+            @test_throws ArgumentError Tables.eachgroup(table)
+            @test_throws ArgumentError Tables.eachgroup(table, :GROUP; order=:sideways)
+
+            delete!(table, :GROUP)
+        end
+
+        @testset "Chunked iteration" begin
+            scalars, arrs = table[:SCALAR][:], table[:ARR][:, :, :]
+            chunks = Tables.eachchunk(table, [:SCALAR, :ARR]; rows=300)
+            @test length(chunks) == 4
+
+            seen = 0
+            for chunk in chunks
+                @test chunk.SCALAR == scalars[chunk.rows]
+                @test chunk.ARR == arrs[:, :, chunk.rows]
+                seen += length(chunk.rows)
+            end
+            @test seen == 1_000
+
+            # Iteration can be restarted, including after being abandoned mid-way
+            first(chunks)
+            @test sum(chunk -> sum(chunk.SCALAR), chunks) ≈ sum(scalars)
+
+            @test_throws ArgumentError Tables.eachchunk(table, [:ARR_UNKNOWN])
+            @test_throws ArgumentError Tables.eachchunk(table, [:STRING])
+            @test_throws ArgumentError Tables.eachchunk(table, [:SCALAR]; rows=0)
+        end
+
+        @testset "Write queue" begin
+            queue = Tables.WriteQueue(table; maxbytes=1024)
+            scalars = queue[:SCALAR]
+            arrs = queue[:ARR]
+
+            vals = rand(1_000)
+            arrvals = rand(Int16, 3, 4, 1_000)
+            for rows in (1:250, 251:500, 501:750, 751:1_000)
+                scalars[rows] = vals[rows]
+                arrs[:, :, rows] = arrvals[:, :, rows]
+            end
+            arrs[2, :, [1, 3, 5]] = zeros(Int16, 4, 3)
+            arrvals[2, :, [1, 3, 5]] .= 0
+
+            # Buffers may be reused as soon as they are enqueued
+            buffer = fill(1.5, 10)
+            scalars[1:10] = buffer
+            fill!(buffer, 0)
+            vals[1:10] .= 1.5
+
+            Tables.flush(queue)
+            @test table[:SCALAR][:] == vals
+            @test table[:ARR][:, :, :] == arrvals
+
+            @test_throws DimensionMismatch scalars[1:10] = rand(5)
+            @test_throws BoundsError scalars[1_001] = 1.0
+            @test_throws ArgumentError queue[:ARR_UNKNOWN]
+            @test_throws ArgumentError Tables.WriteQueue(table; maxbytes=0)
+        end
+
+        @testset "Statistics and averaging" begin
+            t = Tables.Table(joinpath(mktempdir(), "reduce.ms"), Tables.New)
+            resize!(t, 20)
+            data, flags = rand(ComplexF32, 2, 6, 20), rand(Bool, 2, 6, 20)
+            weights = rand(Float32, 2, 20)
+            t[:DATA], t[:FLAG], t[:WEIGHT] = data, flags, weights
+            scalars, flagrow = rand(20), rand(Bool, 20)
+            t[:SCALAR], t[:FLAG_ROW] = scalars, flagrow
+
+            stats = Tables.statistics(t[:SCALAR]; rows=7)
+            @test stats.count == 20
+            @test stats.flagged == 0
+            @test stats.min == minimum(scalars)
+            @test stats.max == maximum(scalars)
+            @test stats.mean ≈ sum(scalars) / 20
+            @test stats.std ≈ sqrt(sum(abs2, scalars .- stats.mean) / 20)
+
+            # Stable for a large offset compared with the spread, as for TIME
+            times = 5e9 .+ rand(20)
+            t[:TIME] = times
+            stats = Tables.statistics(t[:TIME]; rows=3)
+            @test stats.mean ≈ sum(times .- 5e9) / 20 + 5e9
+            @test stats.std ≈ sqrt(sum(abs2, times .- stats.mean) / 20) rtol=1e-4
+
+            stats = Tables.statistics(t[:SCALAR]; flags=:FLAG_ROW)
+            @test stats.count == count(!, flagrow)
+            @test stats.flagged ≈ count(flagrow) / 20
+            @test stats.max == maximum(scalars[.!flagrow])
+
+            # No unflagged samples
+            t[:ALLFLAGGED] = fill(true, 20)
+            stats = Tables.statistics(t[:SCALAR]; flags=:ALLFLAGGED)
+            @test stats.count == 0
+            @test stats.flagged == 1
+            @test all(isnan, (stats.min, stats.max, stats.mean, stats.std))
+
+            stats = Tables.statistics(t[:DATA]; flags=:FLAG, rows=3)
+            @test stats.count == count(!, flags)
+            @test stats.mean ≈ sum(abs.(data[.!flags])) / count(!, flags)
+
+            # Average pairs of channels and 3 rows (leaving a partial final bin of 2 rows)
+            avg = Tables.average(t[:DATA], (1, 2, 3); flags=:FLAG, weights=:WEIGHT, rows=4)
+            @test size(avg.data) == size(avg.weight) == (2, 3, 7)
+            for i in 1:2, j in 1:3, k in 1:7
+                chans, rows = (2j - 1):2j, (3k - 2):min(3k, 20)
+                w = [flags[i, c, r] ? 0.0 : Float64(weights[i, r]) for c in chans, r in rows]
+                @test avg.weight[i, j, k] ≈ sum(w)
+                if sum(w) > 0
+                    @test avg.data[i, j, k] ≈ sum(w .* data[i, chans, rows]) / sum(w)
+                else
+                    @test avg.data[i, j, k] == 0
+                end
+            end
+
+            # Variable shape weights are read with the shape of their cells
+            t[:VARWEIGHT] = Tables.ArrayColumnDesc{Float32, 1}()
+            t[:VARWEIGHT][:] = [weights[:, r] for r in 1:20]
+            varavg = Tables.average(t[:DATA], (1, 2, 3); flags=:FLAG, weights=:VARWEIGHT, rows=4)
+            @test varavg.data ≈ avg.data
+            @test varavg.weight ≈ avg.weight
+
+            t[:VARWEIGHT][20] = rand(Float32, 1)
+            @test_throws Exception Tables.average(t[:DATA], (1, 2, 3); weights=:VARWEIGHT)
+
+            avg = Tables.average(t[:DATA], (2, 6, 20))
+            @test avg.data[1, 1, 1] ≈ sum(data) / length(data)
+
+            @test_throws ArgumentError Tables.average(t[:DATA], (1, 0, 1))
+            @test_throws ArgumentError Tables.average(t[:SCALAR], (2,))
+            @test_throws ArgumentError Tables.statistics(t[:SCALAR]; rows=0)
+        end
+
+        @testset "Append rows" begin
+            t = Tables.Table(joinpath(mktempdir(), "append.ms"), Tables.New)
+            t[:TIME] = Tables.ScalarColumnDesc{Float64}()
+            t[:DATA] = Tables.ArrayColumnDesc{ComplexF32, 2}((2, 3))
+            t[:NAME] = Tables.ScalarColumnDesc{String}()
+            t[:FLAGS] = Tables.ArrayColumnDesc{Bool, 1}()
+
+            times, data = rand(10), rand(ComplexF32, 2, 3, 10)
+            names, flags = string.(1:10), [rand(Bool, i) for i in 1:10]
+            append!(t, (TIME=times, DATA=data, NAME=names, FLAGS=flags))
+            @test size(t, 1) == 10
+            @test t[:TIME][:] == times
+            @test t[:DATA][:, :, :] == data
+            @test t[:NAME][:] == names
+            @test t[:FLAGS][:] == flags
+
+            # Values are converted to the column type
+            append!(t, (TIME=1:5, DATA=ones(Int, 2, 3, 5)))
+            @test size(t, 1) == 15
+            @test t[:TIME][11:15] == 1:5
+            @test t[:DATA][:, :, 11:15] == ones(ComplexF32, 2, 3, 5)
+
+            @test_throws DimensionMismatch append!(t, (TIME=rand(3), DATA=rand(ComplexF32, 2, 3, 4)))
+            @test_throws DimensionMismatch append!(t, (DATA=rand(ComplexF32, 3, 3, 4),))
+            @test_throws KeyError append!(t, (MISSING=rand(3),))
+            @test size(t, 1) == 15
+
+            # Rows are removed again if a variably shaped column cannot be written
+            @test_throws DimensionMismatch append!(t, (TIME=rand(3), FLAGS=[rand(Bool, 2, 2) for _ in 1:3]))
+            @test size(t, 1) == 15
+            @test t[:TIME][11:15] == 1:5
+
+            Tables.Appender(t, [:TIME, :DATA]; rows=4) do appender
+                for i in 1:5
+                    append!(appender, (TIME=fill(i, 3), DATA=fill(ComplexF32(i), 2, 3, 3)))
+                end
+                # Rows are only added in whole batches until flushed
+                @test size(t, 1) == 15 + 12
+            end
+            @test size(t, 1) == 30
+            @test t[:TIME][16:30] == repeat(1:5; inner=3)
+            @test t[:DATA][:, :, 30] == fill(5, 2, 3)
+
+            @test_throws ArgumentError Tables.Appender(t, [:NAME])
+            @test_throws ArgumentError Tables.Appender(t, [:TIME]; rows=0)
+            @test_throws ArgumentError append!(Tables.Appender(t, [:TIME]), (DATA=data,))
+        end
+
+        @testset "TaQL" begin
+            t = Tables.Table(joinpath(mktempdir(), "taql.ms"), Tables.New)
+            resize!(t, 10)
+            t[:A] = collect(1:10)
+            uvw = rand(3, 10)
+            t[:UVW] = uvw
+
+            @test size(taql(raw"SELECT FROM $1 WHERE A > 5", t)) == (5, 2)
+
+            rows = taqlrows(raw"SELECT FROM $1 WHERE A > 5", t)
+            @test rows == 6:10
+            @test t[:A][rows] == 6:10
+            @test taqlrows(raw"SELECT FROM $1 WHERE A > 5 ORDERBY A DESC", t) == 10:-1:6
+
+            lengths = Vector{Float64}(undef, 10)
+            taqlcalc!(lengths, raw"CALC sqrt(sumsqr(UVW)) FROM $1", t)
+            @test lengths ≈ vec(sqrt.(sum(abs2, uvw; dims=1)))
+
+            doubled = Matrix{Float64}(undef, 3, 10)
+            taqlcalc!(doubled, raw"CALC UVW * 2 FROM $1", t)
+            @test doubled ≈ 2 * uvw
+
+            mask = Vector{Bool}(undef, 10)
+            taqlcalc!(mask, raw"CALC A > 5 FROM $1", t)
+            @test mask == (1:10 .> 5)
+
+            @test_throws Exception taqlcalc!(Vector{Float64}(undef, 3), raw"CALC A FROM $1", t)
+            @test_throws Exception taqlcalc!(lengths, raw"SELECT FROM $1", t)
+        end
+
+        @testset "Concatenation and parallel reads" begin
+            dir = mktempdir()
+            nrows = [5, 0, 7, 3]
+            times = [rand(n) for n in nrows]
+            uvws = [rand(3, n) for n in nrows]
+            parts = map(enumerate(nrows)) do (i, n)
+                t = Tables.Table(joinpath(dir, "part$(i).ms"), Tables.New)
+                resize!(t, n)
+                t[:TIME] = Tables.ScalarColumnDesc{Float64}()
+                t[:UVW] = Tables.ArrayColumnDesc{Float64, 1}((3,))
+                t[:NAME] = Tables.ScalarColumnDesc{String}()
+                if n > 0
+                    t[:TIME][:] = times[i]
+                    t[:UVW][:, :] = uvws[i]
+                end
+                t
+            end
+
+            concatenated = vcat(parts...)
+            @test size(concatenated) == (15, 3)
+            @test concatenated[:TIME][:] == reduce(vcat, times)
+            @test concatenated[:UVW][:, :] == reduce(hcat, uvws)
+
+            @test Tables.readparallel(parts, :TIME) == reduce(vcat, times)
+            @test Tables.readparallel(parts, :UVW; nthreads=2) == reduce(hcat, uvws)
+
+            dest = Matrix{Float64}(undef, 3, 15)
+            @test Tables.readparallel!(dest, parts, :UVW; nthreads=1) === dest
+            @test dest == reduce(hcat, uvws)
+
+            # Tables sharing a root table are read by the same thread
+            selection = taql(raw"SELECT FROM $1 WHERE TIME > 0.5", parts[1])
+            shared = [parts[1], parts[3], parts[1], selection]
+            @test Tables.readparallel(shared, :UVW; nthreads=4) ==
+                hcat(uvws[1], uvws[3], uvws[1], uvws[1][:, times[1] .> 0.5])
+
+            @test_throws DimensionMismatch Tables.readparallel!(Matrix{Float64}(undef, 3, 14), parts, :UVW)
+            @test_throws ArgumentError Tables.readparallel!(Matrix{Float32}(undef, 3, 15), parts, :UVW)
+            @test_throws ArgumentError Tables.readparallel(parts, :NAME)
+            @test_throws ArgumentError Tables.readparallel(parts, :TIME; nthreads=0)
+            @test_throws ArgumentError Tables.readparallel(Tables.Table[], :TIME)
+        end
+
+        @testset "I/O statistics" begin
+            t = Tables.Table(joinpath(mktempdir(), "iostats.ms"), Tables.New)
+            resize!(t, 10)
+            t[:TIME] = Tables.ScalarColumnDesc{Float64}()
+            t[:DATA] = Tables.ArrayColumnDesc{ComplexF32, 2}((2, 3))
+
+            Tables.resetiostats!()
+            t[:TIME][:] = rand(10)
+            @test isempty(Tables.iostats(t))
+
+            Tables.instrument!()
+            t[:TIME][:] = rand(10)
+            t[:TIME][:]
+            t[:TIME][1]
+            t[:DATA][:, :, :] = rand(ComplexF32, 2, 3, 10)
+            Tables.instrument!(false)
+            t[:DATA][:, :, :]
+
+            stats = Tables.iostats(t)
+            @test Set(keys(stats)) == Set([:TIME, :DATA])
+            @test stats[:TIME].putcalls == 1
+            @test stats[:TIME].putbytes == 80
+            @test stats[:TIME].getcalls == 2
+            @test stats[:TIME].getbytes == 88
+            @test stats[:DATA].putcalls == 1
+            @test stats[:DATA].putbytes == 2 * 3 * 10 * 8
+            @test stats[:DATA].getcalls == 0
+            @test stats[:TIME].putseconds > 0
+
+            Tables.resetiostats!(t)
+            @test isempty(Tables.iostats(t))
+        end
+
+        @testset "Zero-copy arrays" begin
+            t = Tables.Table(joinpath(mktempdir(), "asarray.ms"), Tables.New)
+            resize!(t, 10)
+            data, flags = rand(ComplexF32, 2, 3, 10), rand(Bool, 10)
+            t[:DATA] = data
+            t[:FLAG] = flags
+
+            arr = LibCasacore.asarray(LibCasacore.getColumn(t[:DATA].columnref))
+            @test arr isa Array{ComplexF32, 3}
+            @test arr == data
+            @test LibCasacore.asarray(LibCasacore.getColumn(t[:FLAG].columnref)) == flags
+            @test LibCasacore.asarray(LibCasacore.Vector{Float64}()) == Float64[]
+
+            # Storage is shared with the casacore array
+            x = LibCasacore.Array{Float64}(LibCasacore.IPosition((2, 3)))
+            y = LibCasacore.asarray(x)
+            @test size(y) == (2, 3)
+            y .= reshape(1:6, 2, 3)
+            @test LibCasacore.tovector(x) == 1:6
+        end
+
         @testset "Delete columns" begin
             for colname in [:SCALAR, :ARR_UNKNOWN, :ARR_NOSHAPE, :ARR, :STRING]
                 @test colname ∈ keys(table)